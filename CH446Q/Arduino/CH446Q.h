@@ -0,0 +1,939 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// CH446Q 16x8 analog crosspoint switch driver for the ATmega328 boards, the Raspberry Pi Pico and the ESP32.
+// This is the only copy. The other sketches get it through libraries/CH446Q (with the repository
+// as the sketchbook folder) and the Pico build through its include path.
+//
+// Everything is defined in this header, inline or as a static member of a class template, so it
+// can be included from several files of one program. The configuration macros below have to be
+// the same in all of them.
+//
+// The switch logic (range checks, batches, shadow state, clears) is written once in CH446Q<Pins>.
+// Pins is a board policy of static functions, so every call is resolved and inlined at compile time:
+//   init()                  every CH446Q line an output, all low
+//   begin()                 called before a run of select() calls, e.g. to re-read shared ports
+//   select(addr, x, y, on)  drives ADDR, AX, AY and DAT
+//   strobe()                pulses STB for CH446Q_STROBE_NS
+//   end()                   called after the run
+//   levels(addr, x, y, on)  reads back the ADDR, AX, AY and DAT levels being driven
+//   SORT_OPS                whether batches should be reordered by ch446qScheduleOps first
+// The policy of the target being compiled is picked below. For other wiring, define CH446Q_PINS
+// to a policy of your own before including this file. Defining CH446Q_STATS wraps the policy in
+// CH446QStatsPins, which counts strobes, bus toggles and time (see ch446qStats).
+
+#define MAX_ADDRESS 15 // change later
+#define MAX_AX 15 // 2^n -1
+#define MAX_AY 7
+
+// STB high time. The CH446Q latches on the strobe and needs only a short pulse (tens of ns),
+// so the old delayMicroseconds(2) is replaced by a cycle count; 100 ns leaves margin over the
+// datasheet minimum. Define it before including this file for long wires or level shifters.
+#ifndef CH446Q_STROBE_NS
+#define CH446Q_STROBE_NS 100
+#endif
+
+// Value 0 .. size - 1 whose table entry matches the output register out, for tables of GPIO bits
+// (an entry per value, the last one every bit), as the Pico and ESP32 policies build them
+inline uint8_t ch446qDecodeLevels(uint32_t out, const uint32_t *table, uint8_t size){
+  for (uint8_t value = 0; value < size; value++){
+    if ((out & table[size - 1]) == table[value]){
+      return value;
+    }
+  }
+  return 0;
+}
+
+#if defined(__AVR__)
+
+#include "Arduino.h"
+
+#define STB (1 << PORTB3)
+#define STB_DDR (1 << DDB3)
+
+#define DAT (1 << PORTB4)
+#define DAT_DDR (1 << DDB4)
+
+#define AY0 (1 << PORTB0)
+#define AY1 (1 << PORTB1)
+#define AY2 (1 << PORTB2)
+
+#define AY0_DDR (1 << DDB0)
+#define AY1_DDR (1 << DDB1)
+#define AY2_DDR (1 << DDB2)
+
+#define AX0 (1 << PORTC0) //A0
+#define AX1 (1 << PORTC1) //A1
+#define AX2 (1 << PORTC2) //A2
+#define AX3 (1 << PORTC3) //A3
+
+#define AX0_DDR (1 << DDC0) //A0
+#define AX1_DDR (1 << DDC1) //A1
+#define AX2_DDR (1 << DDC2) //A2
+#define AX3_DDR (1 << DDC3) //A3
+
+#define AX_PORT PORTC
+#define AY_PORT PORTB
+#define CONTROL_PORT PORTB
+
+#define AX_PORT_DDR DDRC
+#define AY_PORT_DDR DDRB
+#define CONTROL_PORT_DDR DDRB
+
+#define ADDR0 (1 << PORTD4)
+#define ADDR1 (1 << PORTD5)
+#define ADDR2 (1 << PORTD6)
+#define ADDR3 (1 << PORTD7)
+
+#define ADDR0_DDR (1 << DDD4)
+#define ADDR1_DDR (1 << DDD5)
+#define ADDR2_DDR (1 << DDD6)
+#define ADDR3_DDR (1 << DDD7)
+
+#define ADDR_PORT PORTD
+#define ADDR_PORT_DDR DDRD
+
+#define CH446Q_STROBE_CYCLES ((F_CPU / 1000000UL * CH446Q_STROBE_NS + 999) / 1000)
+
+// Optional RST line (active high, clears every switch of every chip wired to it). Define all three
+// before including this file when it is wired, e.g. to D13:
+//   #define CH446Q_RST (1 << PORTB5)
+//   #define CH446Q_RST_PORT PORTB
+//   #define CH446Q_RST_DDR DDRB
+#ifndef CH446Q_RESET_NS
+#define CH446Q_RESET_NS 1000
+#endif
+
+#define CH446Q_RESET_CYCLES ((F_CPU / 1000000UL * CH446Q_RESET_NS + 999) / 1000)
+
+// Copies of the ports CH446QAvrPins writes, a template only so the header can define them
+template <class = void>
+struct CH446QAvrPorts {
+  static uint8_t addrPort;
+  static uint8_t axPort;
+  static uint8_t controlPort; // AY, DAT and STB
+};
+
+template <class T> uint8_t CH446QAvrPorts<T>::addrPort;
+template <class T> uint8_t CH446QAvrPorts<T>::axPort;
+template <class T> uint8_t CH446QAvrPorts<T>::controlPort;
+
+// ATmega328: ADDR on PORTD 4-7, AX on PORTC 0-3, AY, DAT and STB on PORTB.
+// The ports are shared with other pins (the LED data lines are on PORTD), so begin() takes a copy
+// of them and select() only writes a port when one of its CH446Q bits changes.
+struct CH446QAvrPins : CH446QAvrPorts<> {
+  // Every port that doesn't change is a write saved, so batches are worth scheduling
+  static constexpr bool SORT_OPS = true;
+
+  static void init(){
+    ADDR_PORT_DDR |= ADDR0_DDR | ADDR1_DDR | ADDR2_DDR | ADDR3_DDR; // Init D Port Arduino
+
+    ADDR_PORT &= ~(ADDR0 | ADDR1 | ADDR2 | ADDR3);
+
+
+    AY_PORT_DDR |= AY0_DDR | AY1_DDR | AY2_DDR;// Init B Port Arduino
+
+    AY_PORT &= ~(AY0 | AY1 | AY2);
+
+
+    AX_PORT_DDR |= AX0_DDR | AX1_DDR | AX2_DDR | AX3_DDR;// Init C Port Arduino
+
+    AX_PORT &= ~(AX0 | AX1 | AX2 | AX3);
+
+
+    CONTROL_PORT_DDR |= STB_DDR | DAT_DDR;
+
+    CONTROL_PORT |= DAT;
+    CONTROL_PORT &= ~STB;
+
+#ifdef CH446Q_RST
+    CH446Q_RST_DDR |= CH446Q_RST;
+#endif
+  }
+
+  static void begin(){
+    addrPort = ADDR_PORT;
+    axPort = AX_PORT;
+    controlPort = CONTROL_PORT & ~STB;
+  }
+
+  static void select(uint8_t addr, uint8_t x, uint8_t y, bool on){
+    uint8_t nextAddr = (addrPort & 0x0F) | (addr << 4); /// pazq starta stojnost na 4-te bita koito ne iskam da pipam i zadavam nova stojnost na 4 bita, kojto promenqm
+    if (nextAddr != addrPort){
+      ADDR_PORT = addrPort = nextAddr;
+    }
+
+    uint8_t nextAx = (axPort & 0xF0) | x;
+    if (nextAx != axPort){
+      AX_PORT = axPort = nextAx;
+    }
+
+    uint8_t nextControl = (controlPort & ~(DAT | AY0 | AY1 | AY2)) | y | (on ? DAT : 0);
+    if (nextControl != controlPort){
+      CONTROL_PORT = controlPort = nextControl;
+    }
+  }
+
+  static void strobe(){
+    CONTROL_PORT = controlPort | STB;
+    __builtin_avr_delay_cycles(CH446Q_STROBE_CYCLES);
+    CONTROL_PORT = controlPort;
+  }
+
+  static void end(){
+  }
+
+  static void levels(uint8_t &addr, uint8_t &x, uint8_t &y, bool &on){
+    addr = ADDR_PORT >> 4;
+    x = AX_PORT & (AX0 | AX1 | AX2 | AX3);
+    y = CONTROL_PORT & (AY0 | AY1 | AY2);
+    on = CONTROL_PORT & DAT;
+  }
+
+#ifdef CH446Q_RST
+  // Every switch of every chip on the line opens at once
+  static void reset(){
+    CH446Q_RST_PORT |= CH446Q_RST;
+    __builtin_avr_delay_cycles(CH446Q_RESET_CYCLES);
+    CH446Q_RST_PORT &= ~CH446Q_RST;
+  }
+#endif
+};
+
+typedef CH446QAvrPins CH446QBoardPins;
+
+inline uint32_t ch446qMicros(){ return micros(); }
+
+#elif defined(PICO_ON_DEVICE) || defined(LIB_PICO_STDLIB)
+
+#include "pico/stdlib.h"
+#include "hardware/gpio.h"
+
+// GPIO numbers and the precomputed masks, see CH446Q/Rasberry Pi Pico/ch446q_masks.h
+#include "ch446q_masks.h"
+
+// Cycles are counted at CH446Q_SYS_CLK_MHZ, an upper bound of clk_sys so the pulse is never too short
+#ifndef CH446Q_SYS_CLK_MHZ
+#define CH446Q_SYS_CLK_MHZ 150
+#endif
+
+#define CH446Q_STROBE_CYCLES ((CH446Q_SYS_CLK_MHZ * CH446Q_STROBE_NS + 999) / 1000)
+
+// RP2040: all 12 data lines go out in one gpio_put_masked() write
+struct CH446QPicoPins {
+  static constexpr bool SORT_OPS = false;
+
+  static void init(){
+    gpio_init_mask(ch446qMasks.all);
+    gpio_clr_mask(ch446qMasks.all);
+    gpio_set_dir_out_masked(ch446qMasks.all);
+  }
+
+  static void begin(){
+  }
+
+  static void select(uint8_t addr, uint8_t x, uint8_t y, bool on){
+    gpio_put_masked(ch446qMasks.data, ch446qMasks.value(addr, x, y, on));
+  }
+
+  static void strobe(){
+    gpio_set_mask(ch446qMasks.stb);
+    busy_wait_at_least_cycles(CH446Q_STROBE_CYCLES);
+    gpio_clr_mask(ch446qMasks.stb);
+  }
+
+  static void end(){
+  }
+
+  static void levels(uint8_t &addr, uint8_t &x, uint8_t &y, bool &on){
+    uint32_t out = gpio_get_all();
+    addr = ch446qDecodeLevels(out, ch446qMasks.addr, 16);
+    x = ch446qDecodeLevels(out, ch446qMasks.ax, 16);
+    y = ch446qDecodeLevels(out, ch446qMasks.ay, 8);
+    on = out & ch446qMasks.dat;
+  }
+};
+
+typedef CH446QPicoPins CH446QBoardPins;
+
+inline uint32_t ch446qMicros(){ return time_us_32(); }
+
+#elif defined(ESP32)
+
+#include "Arduino.h"
+#include "soc/gpio_reg.h"
+
+#define STB_PIN 12
+#define DAT_PIN 13
+
+#define AY0_PIN 4
+#define AY1_PIN 2
+#define AY2_PIN 15
+
+#define AX0_PIN 18
+#define AX1_PIN 5
+#define AX2_PIN 17
+#define AX3_PIN 16
+
+#define ADDR0_PIN 19
+#define ADDR1_PIN 21
+#define ADDR2_PIN 22
+#define ADDR3_PIN 23
+
+// Tables of CH446QEsp32Pins, a template only so the header can define them
+template <class = void>
+struct CH446QEsp32Tables {
+  // GPIO_OUT bits of every address, AX and AY value
+  static uint32_t addrBits[16];
+  static uint32_t axBits[16];
+  static uint32_t ayBits[8];
+  static uint32_t dataMask; // ADDR, AX, AY and DAT
+  static uint32_t strobeCycles;
+};
+
+template <class T> uint32_t CH446QEsp32Tables<T>::addrBits[16];
+template <class T> uint32_t CH446QEsp32Tables<T>::axBits[16];
+template <class T> uint32_t CH446QEsp32Tables<T>::ayBits[8];
+template <class T> uint32_t CH446QEsp32Tables<T>::dataMask;
+template <class T> uint32_t CH446QEsp32Tables<T>::strobeCycles;
+
+// ESP32: every CH446Q line is on GPIO 0-31, so one write to GPIO_OUT_W1TC and one to GPIO_OUT_W1TS
+// set all data lines, with the levels looked up in tables built by init()
+struct CH446QEsp32Pins : CH446QEsp32Tables<> {
+  static constexpr bool SORT_OPS = false;
+
+  static void buildTable(uint32_t *table, uint8_t size, const uint8_t *pins, uint8_t bits){
+    for (uint8_t value = 0; value < size; value++){
+      table[value] = 0;
+      for (uint8_t bit = 0; bit < bits; bit++){
+        if (value & (1 << bit)){
+          table[value] |= 1UL << pins[bit];
+        }
+      }
+    }
+  }
+
+  static void init(){
+    const uint8_t addrPins[4] = {ADDR0_PIN, ADDR1_PIN, ADDR2_PIN, ADDR3_PIN};
+    const uint8_t axPins[4] = {AX0_PIN, AX1_PIN, AX2_PIN, AX3_PIN};
+    const uint8_t ayPins[3] = {AY0_PIN, AY1_PIN, AY2_PIN};
+    buildTable(addrBits, 16, addrPins, 4);
+    buildTable(axBits, 16, axPins, 4);
+    buildTable(ayBits, 8, ayPins, 3);
+    dataMask = addrBits[15] | axBits[15] | ayBits[7] | (1UL << DAT_PIN);
+
+    // Cycle count of the STB pulse at the current CPU clock, rounded up
+    strobeCycles = (getCpuFrequencyMhz() * CH446Q_STROBE_NS + 999) / 1000;
+
+    REG_WRITE(GPIO_OUT_W1TC_REG, dataMask | (1UL << STB_PIN));
+    pinMode(STB_PIN, OUTPUT);
+    for (uint8_t pin = 0; pin < 32; pin++){
+      if (dataMask & (1UL << pin)){
+        pinMode(pin, OUTPUT);
+      }
+    }
+  }
+
+  static void begin(){
+  }
+
+  static void select(uint8_t addr, uint8_t x, uint8_t y, bool on){
+    uint32_t high = addrBits[addr] | axBits[x] | ayBits[y] | (on ? 1UL << DAT_PIN : 0);
+    REG_WRITE(GPIO_OUT_W1TC_REG, dataMask & ~high);
+    REG_WRITE(GPIO_OUT_W1TS_REG, high);
+  }
+
+  static void strobe(){
+    REG_WRITE(GPIO_OUT_W1TS_REG, 1UL << STB_PIN);
+    uint32_t start = ESP.getCycleCount();
+    while (ESP.getCycleCount() - start < strobeCycles){
+    }
+    REG_WRITE(GPIO_OUT_W1TC_REG, 1UL << STB_PIN);
+  }
+
+  static void end(){
+  }
+
+  static void levels(uint8_t &addr, uint8_t &x, uint8_t &y, bool &on){
+    uint32_t out = REG_READ(GPIO_OUT_REG);
+    addr = ch446qDecodeLevels(out, addrBits, 16);
+    x = ch446qDecodeLevels(out, axBits, 16);
+    y = ch446qDecodeLevels(out, ayBits, 8);
+    on = out & (1UL << DAT_PIN);
+  }
+};
+
+typedef CH446QEsp32Pins CH446QBoardPins;
+
+inline uint32_t ch446qMicros(){ return micros(); }
+
+#elif !defined(CH446Q_PINS)
+#error "No CH446Q pin policy for this target, define CH446Q_PINS before including CH446Q.h"
+#endif
+
+#ifndef CH446Q_PINS
+#define CH446Q_PINS CH446QBoardPins
+#endif
+
+#ifdef CH446Q_STATS
+// Totals since the last ch446qResetStats(). A run is one driver call: a command when it strobes
+// once (setConnection), a batch when it strobes more (ch446qApply, ch446qClear, ch446qApplyConfig...).
+struct CH446QStats {
+  uint32_t commands;
+  uint32_t commandMicros;
+  uint32_t batches;
+  uint32_t batchStrobes;
+  uint32_t batchMicros;
+  uint32_t strobes;
+  uint32_t toggles;    // Level changes of ADDR, AX, AY, DAT and STB lines
+  uint32_t lastMicros; // The last run
+  uint32_t maxMicros;  // The slowest run
+  uint16_t verified;   // ch446qVerifyLoopback() results
+  uint16_t verifyFailures;
+};
+
+template <class = void>
+struct CH446QStatsState {
+  static CH446QStats stats;
+};
+
+template <class T> CH446QStats CH446QStatsState<T>::stats;
+
+static CH446QStats &ch446qStats = CH446QStatsState<>::stats;
+
+inline void ch446qResetStats(){ memset(&ch446qStats, 0, sizeof(ch446qStats)); }
+
+// Policy wrapper that counts what the wrapped policy does into ch446qStats.
+// The line levels are read back after init() and then followed from the selects, so toggles are exact.
+template <class Pins>
+struct CH446QStatsPins {
+  static constexpr bool SORT_OPS = Pins::SORT_OPS;
+
+  static uint8_t lastAddr, lastX, lastY;
+  static bool lastOn;
+  static uint16_t runStrobes;
+  static uint32_t runStart;
+
+  static void init(){
+    Pins::init();
+    Pins::levels(lastAddr, lastX, lastY, lastOn);
+  }
+
+  static void begin(){
+    runStart = ch446qMicros();
+    runStrobes = 0;
+    Pins::begin();
+  }
+
+  static void select(uint8_t addr, uint8_t x, uint8_t y, bool on){
+    ch446qStats.toggles += __builtin_popcount(addr ^ lastAddr) + __builtin_popcount(x ^ lastX) + __builtin_popcount(y ^ lastY) + (on != lastOn);
+    lastAddr = addr;
+    lastX = x;
+    lastY = y;
+    lastOn = on;
+    Pins::select(addr, x, y, on);
+  }
+
+  static void strobe(){
+    Pins::strobe();
+    runStrobes++;
+    ch446qStats.toggles += 2;
+  }
+
+  static void end(){
+    Pins::end();
+    uint32_t elapsed = ch446qMicros() - runStart;
+    if (runStrobes == 1){
+      ch446qStats.commands++;
+      ch446qStats.commandMicros += elapsed;
+    }else if (runStrobes > 1){
+      ch446qStats.batches++;
+      ch446qStats.batchStrobes += runStrobes;
+      ch446qStats.batchMicros += elapsed;
+    }else{
+      return;
+    }
+    ch446qStats.strobes += runStrobes;
+    ch446qStats.lastMicros = elapsed;
+    if (elapsed > ch446qStats.maxMicros){
+      ch446qStats.maxMicros = elapsed;
+    }
+  }
+
+  static void levels(uint8_t &addr, uint8_t &x, uint8_t &y, bool &on){
+    Pins::levels(addr, x, y, on);
+  }
+
+#ifdef CH446Q_RST
+  static void reset(){
+    Pins::reset();
+  }
+#endif
+};
+
+template <class Pins> uint8_t CH446QStatsPins<Pins>::lastAddr;
+template <class Pins> uint8_t CH446QStatsPins<Pins>::lastX;
+template <class Pins> uint8_t CH446QStatsPins<Pins>::lastY;
+template <class Pins> bool CH446QStatsPins<Pins>::lastOn;
+template <class Pins> uint16_t CH446QStatsPins<Pins>::runStrobes;
+template <class Pins> uint32_t CH446QStatsPins<Pins>::runStart;
+
+typedef CH446QStatsPins<CH446Q_PINS> CH446QDriverPins;
+#else
+typedef CH446Q_PINS CH446QDriverPins;
+#endif
+
+// One switch of a batch: chip address (0-15), X (0-15), Y (0-7) and close (true) / open (false).
+// Packed into two bytes so a whole row of both chips fits on the stack.
+struct CH446QOp {
+  uint8_t addr : 4;
+  uint8_t x : 4;
+  uint8_t y : 3;
+  uint8_t on : 1;
+};
+
+// Which switch an op is for: chip, then Y, then X
+inline uint16_t ch446qOpKey(const CH446QOp &op){
+  return (op.addr << 7) | (op.y << 4) | op.x;
+}
+
+// What an op puts on the AX/AY/DAT lines the chips share: Y and DAT (PORTB on the AVR boards) first,
+// then X, so the lines that change least often sort highest
+inline uint8_t ch446qBusKey(const CH446QOp &op){
+  return (op.y << 5) | (op.on << 4) | op.x;
+}
+
+// Stable insertion sort by key; batches are small and usually generated in order already,
+// and stability keeps two ops on the same switch in the order the caller gave them
+template <typename Key>
+inline void ch446qSortOpsBy(CH446QOp *ops, uint16_t count, Key key){
+  for (uint16_t i = 1; i < count; i++){
+    CH446QOp op = ops[i];
+    uint16_t opKey = key(op);
+    uint16_t j = i;
+    while (j > 0 && key(ops[j - 1]) > opKey){
+      ops[j] = ops[j - 1];
+      j--;
+    }
+    ops[j] = op;
+  }
+}
+
+inline void ch446qSortOps(CH446QOp *ops, uint16_t count){
+  ch446qSortOpsBy(ops, count, ch446qOpKey);
+}
+
+// Line groups (address, AX, AY and DAT) that change from op to op over a batch, the first op counting all three
+inline uint16_t ch446qBusChanges(const CH446QOp *ops, uint16_t count){
+  uint16_t changes = count > 0 ? 3 : 0;
+  for (uint16_t i = 1; i < count; i++){
+    changes += (ops[i].addr != ops[i - 1].addr) + (ops[i].x != ops[i - 1].x);
+    changes += (ops[i].y != ops[i - 1].y || ops[i].on != ops[i - 1].on);
+  }
+  return changes;
+}
+
+// Which switch an op is for, with every open sorting before every close
+inline uint16_t ch446qOpenFirstKey(const CH446QOp &op){
+  return (op.on << 11) | ch446qOpKey(op);
+}
+
+// Keeps only the last op on each switch and puts every open before any close, each part in chip
+// order, so a net being rerouted is never joined to the next one on the way. Returns the number of ops left.
+inline uint16_t ch446qOrderOps(CH446QOp *ops, uint16_t count){
+  // Ops on the same switch end up next to each other, in caller order
+  ch446qSortOps(ops, count);
+  uint16_t kept = 0;
+  for (uint16_t i = 0; i < count; i++){
+    if (i + 1 < count && ch446qOpKey(ops[i + 1]) == ch446qOpKey(ops[i])){
+      continue;
+    }
+    ops[kept++] = ops[i];
+  }
+  ch446qSortOpsBy(ops, kept, ch446qOpenFirstKey);
+  return kept;
+}
+
+// Reorders ops that all open or all close, one per switch in chip order, so the chips that need the
+// same AX/AY values are strobed back to back: the shared lines are set once per group and only the
+// address changes between its strobes. Each group starts on the chip the previous one ended on, if
+// it has it, so that step only changes the bus. With few chips sharing bus values, chip by chip
+// order changes fewer lines, so whichever of the two orders changes fewer is kept.
+inline void ch446qScheduleBus(CH446QOp *ops, uint16_t count){
+  uint16_t chipOrderChanges = ch446qBusChanges(ops, count);
+
+  // Groups of equal bus values, each in chip order from the first sort
+  ch446qSortOpsBy(ops, count, ch446qBusKey);
+
+  for (uint16_t start = 1; start < count;){
+    uint16_t end = start + 1;
+    while (end < count && ch446qBusKey(ops[end]) == ch446qBusKey(ops[start])){
+      end++;
+    }
+    if (ch446qBusKey(ops[start]) != ch446qBusKey(ops[start - 1])){
+      for (uint16_t j = start; j < end; j++){
+        if (ops[j].addr == ops[start - 1].addr){
+          CH446QOp op = ops[j];
+          for (; j > start; j--){
+            ops[j] = ops[j - 1];
+          }
+          ops[start] = op;
+          break;
+        }
+      }
+    }
+    start = end;
+  }
+
+  if (ch446qBusChanges(ops, count) > chipOrderChanges){
+    ch446qSortOps(ops, count);
+  }
+}
+
+// Reorders a batch to change as few bus lines as possible. As with ch446qOrderOps only the last op
+// on each switch is kept and all opens go before all closes; each of the two parts is then
+// scheduled by ch446qScheduleBus. Returns the number of ops left.
+inline uint16_t ch446qScheduleOps(CH446QOp *ops, uint16_t count){
+  uint16_t kept = ch446qOrderOps(ops, count);
+  uint16_t opens = 0;
+  while (opens < kept && !ops[opens].on){
+    opens++;
+  }
+  ch446qScheduleBus(ops, opens);
+  ch446qScheduleBus(ops + opens, kept - opens);
+  return kept;
+}
+
+// Chip address of every MUX on the board, MUX1 first. Each sketch lists its own before including
+// this file, e.g. #define CH446Q_MUX_ADDRESSES {0b1000, 0b1001}; the shadow state below keeps
+// 16 bytes per MUX, so listing only the fitted chips saves SRAM.
+#ifndef CH446Q_MUX_ADDRESSES
+#error "Define CH446Q_MUX_ADDRESSES, the chip addresses fitted on the board, before including CH446Q.h"
+#endif
+
+const uint8_t ch446qMuxAddresses[] = CH446Q_MUX_ADDRESSES;
+const uint8_t CH446Q_MUXES = sizeof(ch446qMuxAddresses);
+
+static_assert(sizeof(ch446qMuxAddresses) <= MAX_ADDRESS + 1, "One address bus selects at most 16 CH446Q chips");
+
+// Index of a chip address in ch446qMuxAddresses, or -1 when no MUX has it
+inline int8_t ch446qMuxIndex(uint8_t addr){
+  for (uint8_t mux = 0; mux < CH446Q_MUXES; mux++){
+    if (ch446qMuxAddresses[mux] == addr){
+      return mux;
+    }
+  }
+  return -1;
+}
+
+// Closed switches as last strobed, per MUX: bit X of ch446qClosed[mux][Y] for the chip at
+// ch446qMuxAddresses[mux]. Chips not in the list are switched but not tracked.
+template <class = void>
+struct CH446QShadow {
+  static uint16_t closed[CH446Q_MUXES][8];
+};
+
+template <class T> uint16_t CH446QShadow<T>::closed[CH446Q_MUXES][8];
+
+static uint16_t (&ch446qClosed)[CH446Q_MUXES][8] = CH446QShadow<>::closed;
+
+inline void ch446qTrack(uint8_t addr, uint8_t x, uint8_t y, bool on){
+  int8_t mux = ch446qMuxIndex(addr);
+  if (mux >= 0){
+    if (on){
+      ch446qClosed[mux][y] |= (uint16_t)1 << x;
+    }else{
+      ch446qClosed[mux][y] &= ~((uint16_t)1 << x);
+    }
+  }
+}
+
+// A whole switch configuration in the same layout as ch446qClosed: bit X of [mux][Y] is closed
+typedef uint16_t CH446QConfig[CH446Q_MUXES][8];
+
+inline void ch446qConfigSet(CH446QConfig config, uint8_t addr, uint8_t x, uint8_t y){
+  int8_t mux = ch446qMuxIndex(addr);
+  if (mux >= 0){
+    config[mux][y] |= (uint16_t)1 << x;
+  }
+}
+
+// Chip address of a chip name from the serial protocol: "MUX<n>" (from 1, as in rules.json) or the
+// address itself in binary digits ("1000" is 0b1000). Returns -1 for anything else.
+inline int8_t ch446qDecodeChip(const char *name){
+  if (name == NULL){
+    return -1;
+  }
+
+  if (strncmp(name, "MUX", 3) == 0){
+    uint8_t mux = 0;
+    const char *digit = name + 3;
+    if (*digit == '\0'){
+      return -1;
+    }
+    for (; *digit != '\0'; digit++){
+      if (*digit < '0' || *digit > '9' || mux > CH446Q_MUXES){
+        return -1;
+      }
+      mux = mux * 10 + (*digit - '0');
+    }
+    if (mux < 1 || mux > CH446Q_MUXES){
+      return -1;
+    }
+    return ch446qMuxAddresses[mux - 1];
+  }
+
+  int8_t addr = 0;
+  uint8_t length = 0;
+  for (; name[length] != '\0'; length++){
+    if ((name[length] != '0' && name[length] != '1') || length == 4){
+      return -1;
+    }
+    addr = (addr << 1) | (name[length] - '0');
+  }
+  return length > 0 ? addr : -1;
+}
+
+template <class Pins>
+struct CH446Q {
+#ifdef CH446Q_RST
+  // Pulses RST and forgets the shadow state
+  static void reset(){
+    Pins::reset();
+    memset(ch446qClosed, 0, sizeof(ch446qClosed));
+  }
+#endif
+
+  // Sets up the CH446Q lines. With RST wired the chips are also reset, so the shadow state starts out right.
+  static void init(){
+    Pins::init();
+#ifdef CH446Q_RST
+    reset();
+#endif
+  }
+
+  static int setConnection(uint8_t addr, uint8_t AX, uint8_t AY, bool mode){
+    if (addr > MAX_ADDRESS || AX > MAX_AX || AY > MAX_AY){
+      return -1;
+    }
+
+    Pins::begin();
+    Pins::select(addr, AX, AY, mode);
+    Pins::strobe();
+    Pins::end();
+
+    ch446qTrack(addr, AX, AY, mode);
+
+    return 1;
+  }
+
+  // Applies a list of switch operations back to back, scheduled in place first if the policy asks
+  // for it. Then only the final state of each switch is guaranteed, with every open before any
+  // close, not the caller's order.
+  // The op fields are as wide as the CH446Q inputs, so there is nothing to range check.
+  static void apply(CH446QOp *ops, uint16_t count){
+    if (Pins::SORT_OPS){
+      count = ch446qScheduleOps(ops, count);
+    }
+
+    Pins::begin();
+    for (uint16_t i = 0; i < count; i++){
+      Pins::select(ops[i].addr, ops[i].x, ops[i].y, ops[i].on);
+      Pins::strobe();
+      ch446qTrack(ops[i].addr, ops[i].x, ops[i].y, ops[i].on);
+    }
+    Pins::end();
+  }
+
+  // Strobes the switches of row Y of one chip that are set in mask, all to the same state.
+  // Returns the number of strobes.
+  static uint8_t strobeRow(uint8_t addr, uint8_t y, uint16_t mask, bool on){
+    Pins::begin();
+    uint8_t strobes = runRow(addr, y, mask, on);
+    Pins::end();
+    return strobes;
+  }
+
+  // Opens all 128 switches of one chip whatever the shadow state says, for when it can't be trusted
+  // (an MCU reset leaves the chips as they were)
+  static void clearChip(uint8_t addr){
+    Pins::begin();
+    for (uint8_t y = 0; y < 8; y++){
+      runRow(addr, y, 0xFFFF, false);
+    }
+    Pins::end();
+  }
+
+  // Opens every closed switch: one RST pulse when it is wired, otherwise a strobe only for the
+  // switches the shadow state has closed, usually a handful instead of 128 per chip.
+  // Returns the number of strobes (0 for a RST pulse).
+  static uint16_t clear(){
+#ifdef CH446Q_RST
+    reset();
+    return 0;
+#else
+    uint16_t strobes = 0;
+    Pins::begin();
+    for (uint8_t mux = 0; mux < CH446Q_MUXES; mux++){
+      for (uint8_t y = 0; y < 8; y++){
+        strobes += runRow(ch446qMuxAddresses[mux], y, ch446qClosed[mux][y], false);
+      }
+    }
+    Pins::end();
+    return strobes;
+#endif
+  }
+
+  // Moves the chips from the shadow state to target, strobing only the switches that differ.
+  // Everything that opens goes first so two nets are never joined halfway through.
+  // Returns the number of strobes.
+  static uint16_t applyConfig(const CH446QConfig target){
+    uint16_t strobes = 0;
+    Pins::begin();
+    for (uint8_t mux = 0; mux < CH446Q_MUXES; mux++){
+      for (uint8_t y = 0; y < 8; y++){
+        strobes += runRow(ch446qMuxAddresses[mux], y, ch446qClosed[mux][y] & ~target[mux][y], false);
+      }
+    }
+    for (uint8_t mux = 0; mux < CH446Q_MUXES; mux++){
+      for (uint8_t y = 0; y < 8; y++){
+        strobes += runRow(ch446qMuxAddresses[mux], y, target[mux][y] & ~ch446qClosed[mux][y], true);
+      }
+    }
+    Pins::end();
+    return strobes;
+  }
+
+private:
+  // strobeRow without the begin() and end(), so a call that strobes several rows is one run
+  static uint8_t runRow(uint8_t addr, uint8_t y, uint16_t mask, bool on){
+    uint8_t strobes = 0;
+    for (uint8_t x = 0; mask != 0; x++, mask >>= 1){
+      if (mask & 1){
+        Pins::select(addr, x, y, on);
+        Pins::strobe();
+        ch446qTrack(addr, x, y, on);
+        strobes++;
+      }
+    }
+    return strobes;
+  }
+};
+
+// The driver of the board being compiled, under the names the sketches use
+typedef CH446Q<CH446QDriverPins> CH446QBoard;
+
+// Switch operations waiting for ch446qFlush(), so commands that arrive together go out as one batch
+#ifndef CH446Q_QUEUE_SIZE
+#define CH446Q_QUEUE_SIZE 32
+#endif
+
+template <class = void>
+struct CH446QQueue {
+  static CH446QOp ops[CH446Q_QUEUE_SIZE];
+  static uint8_t count;
+};
+
+template <class T> CH446QOp CH446QQueue<T>::ops[CH446Q_QUEUE_SIZE];
+template <class T> uint8_t CH446QQueue<T>::count;
+
+static CH446QOp (&ch446qQueued)[CH446Q_QUEUE_SIZE] = CH446QQueue<>::ops;
+static uint8_t &ch446qQueuedCount = CH446QQueue<>::count;
+
+#ifdef CH446Q_RST
+inline void ch446qReset(){ ch446qQueuedCount = 0; CH446QBoard::reset(); }
+#endif
+inline void ch446qInit(){ CH446QBoard::init(); }
+inline int setConnection(uint8_t addr, uint8_t AX, uint8_t AY, bool mode){ return CH446QBoard::setConnection(addr, AX, AY, mode); }
+inline void ch446qApply(CH446QOp *ops, uint16_t count){ CH446QBoard::apply(ops, count); }
+inline uint8_t ch446qStrobeRow(uint8_t addr, uint8_t y, uint16_t mask, bool on){ return CH446QBoard::strobeRow(addr, y, mask, on); }
+inline void ch446qClearChip(uint8_t addr){ CH446QBoard::clearChip(addr); }
+inline uint16_t ch446qClear(){ ch446qQueuedCount = 0; return CH446QBoard::clear(); } // Queued switches are dropped too
+inline uint16_t ch446qApplyConfig(const CH446QConfig target){ return CH446QBoard::applyConfig(target); }
+
+// Strobes the queued operations as one batch in ch446qOrderOps order (or as ch446qScheduleOps
+// orders them, where the policy schedules): only the last operation on a switch counts, and every
+// switch that opens goes before any that closes.
+inline void ch446qFlush(){
+  uint8_t count = ch446qOrderOps(ch446qQueued, ch446qQueuedCount);
+  ch446qApply(ch446qQueued, count);
+  ch446qQueuedCount = 0;
+}
+
+// Queues one switch operation for the next ch446qFlush(), flushing first when the queue is full.
+// Same range check and return value as setConnection.
+inline int ch446qQueue(uint8_t addr, uint8_t AX, uint8_t AY, bool mode){
+  if (addr > MAX_ADDRESS || AX > MAX_AX || AY > MAX_AY){
+    return -1;
+  }
+  if (ch446qQueuedCount == CH446Q_QUEUE_SIZE){
+    ch446qFlush();
+  }
+  ch446qQueued[ch446qQueuedCount++] = {addr, AX, AY, mode};
+  return 1;
+}
+
+#ifdef ARDUINO
+// Continuity check through two spare MCU pins wired to the two ends of a path through the
+// switches, which must be closed first. outPin drives both levels, and inPin only reads each one
+// through the path: pulled up while outPin is LOW, and pulled LOW then left floating while
+// outPin is HIGH. Counted into ch446qStats when CH446Q_STATS is defined.
+inline bool ch446qVerifyLoopback(uint8_t outPin, uint8_t inPin){
+  pinMode(inPin, INPUT_PULLUP);
+  pinMode(outPin, OUTPUT);
+  digitalWrite(outPin, LOW);
+  delayMicroseconds(10);
+  bool passed = digitalRead(inPin) == LOW;
+
+  pinMode(inPin, INPUT); // Clears the pull-up latch, so the pin turns on as an output LOW
+  digitalWrite(inPin, LOW);
+  pinMode(inPin, OUTPUT);
+  delayMicroseconds(10);
+  pinMode(inPin, INPUT);
+  digitalWrite(outPin, HIGH);
+  delayMicroseconds(10);
+  passed = passed && digitalRead(inPin) == HIGH;
+
+  pinMode(outPin, INPUT);
+#ifdef CH446Q_STATS
+  if (passed){
+    ch446qStats.verified++;
+  }else{
+    ch446qStats.verifyFailures++;
+  }
+#endif
+  return passed;
+}
+#endif
+
+#ifdef CH446Q_STATS
+#ifdef ARDUINO
+// Writes ch446qStats as one "name value" pair per line
+inline void ch446qPrintStats(Print &out){
+  out.print(F("commands ")); out.println(ch446qStats.commands);
+  out.print(F("commandMicros ")); out.println(ch446qStats.commandMicros);
+  out.print(F("batches ")); out.println(ch446qStats.batches);
+  out.print(F("batchStrobes ")); out.println(ch446qStats.batchStrobes);
+  out.print(F("batchMicros ")); out.println(ch446qStats.batchMicros);
+  out.print(F("strobes ")); out.println(ch446qStats.strobes);
+  out.print(F("toggles ")); out.println(ch446qStats.toggles);
+  out.print(F("lastMicros ")); out.println(ch446qStats.lastMicros);
+  out.print(F("maxMicros ")); out.println(ch446qStats.maxMicros);
+  out.print(F("verified ")); out.println(ch446qStats.verified);
+  out.print(F("verifyFailures ")); out.println(ch446qStats.verifyFailures);
+}
+#else
+#include <stdio.h>
+
+inline void ch446qPrintStats(){
+  printf("commands %lu\ncommandMicros %lu\nbatches %lu\nbatchStrobes %lu\nbatchMicros %lu\nstrobes %lu\n"
+         "toggles %lu\nlastMicros %lu\nmaxMicros %lu\nverified %u\nverifyFailures %u\n",
+         (unsigned long)ch446qStats.commands, (unsigned long)ch446qStats.commandMicros, (unsigned long)ch446qStats.batches,
+         (unsigned long)ch446qStats.batchStrobes, (unsigned long)ch446qStats.batchMicros, (unsigned long)ch446qStats.strobes,
+         (unsigned long)ch446qStats.toggles, (unsigned long)ch446qStats.lastMicros, (unsigned long)ch446qStats.maxMicros,
+         ch446qStats.verified, ch446qStats.verifyFailures);
+}
+#endif
+#endif
@@ -0,0 +1,125 @@
+#pragma once
+
+// Just enough of the Arduino core for the host tests of CH446Q.h. PORTB, PORTC and PORTD have two
+// CH446Q chips' worth of model behind them: a rising STB latches DAT into the switch that ADDR,
+// AX and AY select. Two digital pins are joined through one of the modelled switches for
+// ch446qVerifyLoopback. The variables are defined in driver_test.cpp.
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define F_CPU 16000000UL
+#define ARDUINO 10819
+
+struct SimChips {
+  bool closed[16][16][8]; // [addr][x][y]
+  long strobes;
+  long opensAfterClose;   // Opens strobed after a close since the last resetOrder()
+  bool closing;
+  long portWrites;
+  long toggles;           // Level changes of the CH446Q lines
+  long contention;        // Times the loopback pins drove different levels into each other
+
+  void resetOrder(){
+    opensAfterClose = 0;
+    closing = false;
+  }
+};
+
+extern SimChips sim;
+
+// CH446Q lines on each port: ADDR on PORTD 4-7, AX on PORTC 0-3, AY, STB and DAT on PORTB 0-4
+struct Port {
+  uint8_t v;
+  uint8_t lines;
+
+  operator uint8_t() const { return v; }
+  Port &operator=(uint8_t next);
+  Port &operator|=(int bits){ return *this = v | bits; }
+  Port &operator&=(int bits){ return *this = v & bits; }
+};
+
+extern Port PORTB, PORTC, PORTD;
+extern uint8_t DDRB, DDRC, DDRD;
+
+inline Port &Port::operator=(uint8_t next){
+  sim.portWrites++;
+  sim.toggles += __builtin_popcount((v ^ next) & lines);
+  bool strobe = &PORTB == this && !(v & 0x08) && (next & 0x08);
+  v = next;
+  if (strobe){
+    bool on = PORTB.v & 0x10;
+    sim.closed[PORTD.v >> 4][PORTC.v & 0x0F][PORTB.v & 0x07] = on;
+    sim.strobes++;
+    sim.opensAfterClose += !on && sim.closing;
+    sim.closing = sim.closing || on;
+  }
+  return *this;
+}
+
+enum { PORTB0, PORTB1, PORTB2, PORTB3, PORTB4, PORTB5 };
+enum { PORTC0, PORTC1, PORTC2, PORTC3 };
+enum { PORTD4 = 4, PORTD5, PORTD6, PORTD7 };
+enum { DDB0, DDB1, DDB2, DDB3, DDB4, DDB5 };
+enum { DDC0, DDC1, DDC2, DDC3 };
+enum { DDD4 = 4, DDD5, DDD6, DDD7 };
+
+#define __builtin_avr_delay_cycles(cycles) ((void)(cycles))
+
+// micros() moves on by one per call, so every run takes some time
+extern unsigned long simMicros;
+inline unsigned long micros(){ return ++simMicros; }
+inline void delayMicroseconds(unsigned int){}
+
+#define F(text) (text)
+
+struct Print {
+  template <class T> void print(T){}
+  template <class T> void println(T){}
+};
+
+// LOOPBACK_OUT and LOOPBACK_IN are joined while switch X0 Y0 of chip 0b1000 is closed. An input
+// without its pull-up keeps the level it last had, like the pin capacitance does for a few us.
+// pinLevels is the AVR output latch: INPUT_PULLUP sets it, INPUT clears it, and a pin made an
+// OUTPUT drives whatever it holds.
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define LOW 0
+#define HIGH 1
+
+#define LOOPBACK_OUT 6
+#define LOOPBACK_IN 7
+
+extern uint8_t pinModes[20];
+extern uint8_t pinLevels[20];
+
+inline void checkLoopbackContention(){
+  if (sim.closed[0b1000][0][0] && pinModes[LOOPBACK_OUT] == OUTPUT && pinModes[LOOPBACK_IN] == OUTPUT
+      && pinLevels[LOOPBACK_OUT] != pinLevels[LOOPBACK_IN]){
+    sim.contention++;
+  }
+}
+
+inline void pinMode(uint8_t pin, uint8_t mode){
+  pinModes[pin] = mode;
+  if (mode != OUTPUT){
+    pinLevels[pin] = mode == INPUT_PULLUP ? HIGH : LOW;
+  }
+  checkLoopbackContention();
+}
+
+inline void digitalWrite(uint8_t pin, uint8_t level){
+  pinLevels[pin] = level;
+  checkLoopbackContention();
+}
+
+inline int digitalRead(uint8_t pin){
+  if (pin == LOOPBACK_IN && sim.closed[0b1000][0][0] && pinModes[LOOPBACK_OUT] == OUTPUT){
+    return pinLevels[LOOPBACK_OUT];
+  }
+  if (pinModes[pin] == INPUT_PULLUP){
+    return HIGH;
+  }
+  return pinLevels[pin];
+}
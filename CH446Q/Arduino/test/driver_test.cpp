@@ -0,0 +1,309 @@
+// Host test of the AVR build of CH446Q.h, no Arduino core or board needed. Arduino.h next to this
+// file models the ports and two CH446Q chips behind them (0b1000 and 0b1001, the fitted MUXes),
+// plus chip 0b0011, which is not in CH446Q_MUX_ADDRESSES and so not tracked.
+//
+// Build and run from this directory:
+//   g++ -std=gnu++11 -D__AVR__ -I. driver_test.cpp second_unit.cpp -o driver_test && ./driver_test
+#define CH446Q_MUX_ADDRESSES {0b1000, 0b1001}
+#define CH446Q_STATS
+
+#include <stdlib.h>
+
+#include "Arduino.h"
+#include "../CH446Q.h"
+
+SimChips sim;
+Port PORTB = {0, 0x1F};
+Port PORTC = {0, 0x0F};
+Port PORTD = {0, 0xF0};
+uint8_t DDRB, DDRC, DDRD;
+unsigned long simMicros;
+uint8_t pinModes[20];
+uint8_t pinLevels[20];
+
+int secondUnitSetConnection(uint8_t addr, uint8_t x, uint8_t y, bool on);
+uint16_t secondUnitClosedRow(uint8_t mux, uint8_t y);
+
+const uint8_t UNTRACKED = 0b0011;
+
+int failures = 0;
+
+void check(bool ok, const char *test, const char *what){
+  if (!ok){
+    printf("%s: %s\n", test, what);
+    failures++;
+  }
+}
+
+CH446QOp randomOp(){
+  const uint8_t chips[3] = {0b1000, 0b1001, UNTRACKED};
+  CH446QOp op = {chips[rand() % 3], (uint8_t)(rand() % 16), (uint8_t)(rand() % 8), (uint8_t)(rand() % 2)};
+  return op;
+}
+
+// The shadow state says what the modelled chips have closed, for every MUX
+bool shadowMatches(){
+  for (uint8_t mux = 0; mux < CH446Q_MUXES; mux++){
+    for (uint8_t y = 0; y < 8; y++){
+      for (uint8_t x = 0; x < 16; x++){
+        if (((ch446qClosed[mux][y] >> x) & 1) != sim.closed[ch446qMuxAddresses[mux]][x][y]){
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+int closedCount(uint8_t addr){
+  int closed = 0;
+  for (uint8_t x = 0; x < 16; x++){
+    for (uint8_t y = 0; y < 8; y++){
+      closed += sim.closed[addr][x][y];
+    }
+  }
+  return closed;
+}
+
+void clearAll(){
+  ch446qClearChip(0b1000);
+  ch446qClearChip(0b1001);
+  ch446qClearChip(UNTRACKED);
+}
+
+// ch446qApply ends with the same switches closed as setConnection one op at a time
+void testApplyMatchesSetConnection(){
+  for (int round = 0; round < 500; round++){
+    CH446QOp ops[60];
+    uint16_t count = 1 + rand() % 60;
+    for (uint16_t i = 0; i < count; i++){
+      ops[i] = randomOp();
+    }
+
+    SimChips before = sim;
+    for (uint16_t i = 0; i < count; i++){
+      setConnection(ops[i].addr, ops[i].x, ops[i].y, ops[i].on);
+    }
+    SimChips single = sim;
+    sim = before;
+
+    ch446qApply(ops, count);
+    check(memcmp(single.closed, sim.closed, sizeof(sim.closed)) == 0, "apply", "differs from setConnection");
+    check(shadowMatches(), "apply", "shadow state differs from the chips");
+  }
+  check(setConnection(16, 0, 0, true) == -1 && setConnection(8, 16, 0, true) == -1 && setConnection(8, 0, 8, true) == -1,
+        "apply", "setConnection out of range not refused");
+}
+
+// Only the MUXes are tracked, and setConnection from another file shares the same state
+void testShadow(){
+  clearAll();
+  setConnection(UNTRACKED, 5, 5, true);
+  check(closedCount(UNTRACKED) == 1 && shadowMatches(), "shadow", "untracked chip changed the shadow state");
+  for (uint8_t mux = 0; mux < CH446Q_MUXES; mux++){
+    for (uint8_t y = 0; y < 8; y++){
+      check(ch446qClosed[mux][y] == 0, "shadow", "row closed after clearChip");
+    }
+  }
+
+  secondUnitSetConnection(0b1001, 3, 6, true);
+  check(ch446qClosed[1][6] == 1 << 3 && secondUnitClosedRow(1, 6) == 1 << 3, "shadow", "second file sees a different state");
+  check(sim.closed[0b1001][3][6], "shadow", "second file didn't strobe");
+}
+
+// ch446qClear opens exactly the switches the shadow state has closed
+void testClear(){
+  for (int round = 0; round < 300; round++){
+    clearAll();
+    int count = rand() % 20;
+    for (int i = 0; i < count; i++){
+      CH446QOp op = randomOp();
+      setConnection(op.addr, op.x, op.y, true);
+    }
+    int tracked = closedCount(0b1000) + closedCount(0b1001);
+    int untracked = closedCount(UNTRACKED);
+
+    long strobes = sim.strobes;
+    uint16_t returned = ch446qClear();
+    check(closedCount(0b1000) + closedCount(0b1001) == 0, "clear", "a MUX switch is still closed");
+    check(closedCount(UNTRACKED) == untracked, "clear", "an untracked chip was strobed");
+    check(returned == tracked && sim.strobes - strobes == tracked, "clear", "strobed switches that were open");
+  }
+}
+
+// ch446qApplyConfig strobes only the differences, opens first, and ends on the target
+void testApplyConfig(){
+  clearAll();
+  for (int round = 0; round < 500; round++){
+    CH446QConfig target;
+    memset(target, 0, sizeof(target));
+    int count = rand() % 30;
+    for (int i = 0; i < count; i++){
+      CH446QOp op = randomOp();
+      ch446qConfigSet(target, op.addr, op.x, op.y);
+    }
+
+    int differences = 0;
+    for (uint8_t mux = 0; mux < CH446Q_MUXES; mux++){
+      for (uint8_t x = 0; x < 16; x++){
+        for (uint8_t y = 0; y < 8; y++){
+          differences += sim.closed[ch446qMuxAddresses[mux]][x][y] != (bool)((target[mux][y] >> x) & 1);
+        }
+      }
+    }
+
+    long strobes = sim.strobes;
+    sim.resetOrder();
+    uint16_t returned = ch446qApplyConfig(target);
+    check(memcmp(target, ch446qClosed, sizeof(target)) == 0 && shadowMatches(), "applyConfig", "chips not on the target");
+    check(returned == differences && sim.strobes - strobes == differences, "applyConfig", "strobed switches already right");
+    check(sim.opensAfterClose == 0, "applyConfig", "opened a switch after closing one");
+  }
+}
+
+// The scheduler keeps the last op on each switch and puts opens before closes, and neither part
+// changes more bus lines than in chip order; ch446qFlush does the same for the queue
+void testScheduler(){
+  for (int round = 0; round < 2000; round++){
+    CH446QOp ops[80];
+    bool last[16][16][8];
+    bool touched[16][16][8] = {};
+    uint16_t count = rand() % 80;
+    for (uint16_t i = 0; i < count; i++){
+      ops[i] = randomOp();
+      last[ops[i].addr][ops[i].x][ops[i].y] = ops[i].on;
+      touched[ops[i].addr][ops[i].x][ops[i].y] = true;
+    }
+
+    CH446QOp ordered[80];
+    memcpy(ordered, ops, sizeof(ops));
+    uint16_t orderedCount = ch446qOrderOps(ordered, count);
+    uint16_t kept = ch446qScheduleOps(ops, count);
+
+    int switches = 0;
+    for (uint8_t addr = 0; addr < 16; addr++){
+      for (uint8_t x = 0; x < 16; x++){
+        for (uint8_t y = 0; y < 8; y++){
+          switches += touched[addr][x][y];
+        }
+      }
+    }
+    check(kept == switches && orderedCount == switches, "scheduler", "not one op per switch");
+
+    bool closing = false;
+    for (uint16_t i = 0; i < kept; i++){
+      check(!closing || ops[i].on, "scheduler", "an open after a close");
+      check(ops[i].on == last[ops[i].addr][ops[i].x][ops[i].y], "scheduler", "not the caller's last op on a switch");
+      closing = closing || ops[i].on;
+    }
+    uint16_t opens = 0;
+    while (opens < kept && !ops[opens].on){
+      opens++;
+    }
+    check(ch446qBusChanges(ops, opens) <= ch446qBusChanges(ordered, opens), "scheduler", "more bus changes than chip order");
+    check(ch446qBusChanges(ops + opens, kept - opens) <= ch446qBusChanges(ordered + opens, orderedCount - opens),
+          "scheduler", "more bus changes than chip order");
+  }
+
+  clearAll();
+  for (int round = 0; round < 500; round++){
+    bool want[16][16][8];
+    memcpy(want, sim.closed, sizeof(want));
+    int count = 1 + rand() % 40;
+    for (int i = 0; i < count; i++){
+      CH446QOp op = randomOp();
+      ch446qQueue(op.addr, op.x, op.y, op.on);
+      want[op.addr][op.x][op.y] = op.on;
+    }
+    sim.resetOrder();
+    ch446qFlush();
+    check(memcmp(want, sim.closed, sizeof(want)) == 0, "flush", "not the last queued op on each switch");
+    check(sim.opensAfterClose == 0, "flush", "opened a switch after closing one");
+    check(ch446qQueuedCount == 0, "flush", "queue not empty");
+  }
+}
+
+// Every driver call is one run, and the counted toggles are the line changes the ports saw
+void testStats(){
+  ch446qInit();
+  clearAll();
+  ch446qResetStats();
+  sim.toggles = 0;
+  long strobes = sim.strobes;
+
+  for (int i = 0; i < 100; i++){
+    CH446QOp op = randomOp();
+    setConnection(op.addr, op.x, op.y, op.on);
+  }
+  check(ch446qStats.commands == 100 && ch446qStats.batches == 0, "stats", "setConnection not one command each");
+
+  CH446QOp ops[32];
+  for (uint8_t x = 0; x < 16; x++){
+    ops[x] = {0b1000, x, 2, true};
+    ops[16 + x] = {0b1001, x, 5, true};
+  }
+  ch446qApply(ops, 32);
+  check(ch446qStats.batches == 1 && ch446qStats.batchStrobes == 32, "stats", "ch446qApply not one batch");
+
+  uint32_t batches = ch446qStats.batches;
+  ch446qClear();
+  check(ch446qStats.batches == batches + 1, "stats", "ch446qClear not one batch");
+
+  CH446QConfig target;
+  memset(target, 0, sizeof(target));
+  ch446qConfigSet(target, 0b1000, 1, 1);
+  ch446qConfigSet(target, 0b1001, 2, 3);
+  ch446qApplyConfig(target);
+  check(ch446qStats.batches == batches + 2, "stats", "ch446qApplyConfig not one batch");
+
+  ch446qClearChip(UNTRACKED);
+  check(ch446qStats.batches == batches + 3, "stats", "ch446qClearChip not one batch");
+
+  check(ch446qStats.strobes == sim.strobes - strobes, "stats", "strobes differ from the chips");
+  check(ch446qStats.toggles == (uint32_t)sim.toggles, "stats", "toggles differ from the ports");
+
+  // init() leaves DAT high and everything else low, so only STB moves
+  ch446qInit();
+  ch446qResetStats();
+  setConnection(0, 0, 0, true);
+  check(ch446qStats.toggles == 2, "stats", "line levels not read back after init");
+}
+
+// The loopback passes through the closed switch only, and its pins never drive into each other
+void testLoopback(){
+  ch446qResetStats();
+  sim.contention = 0;
+  setConnection(0b1000, 0, 0, true);
+  check(ch446qVerifyLoopback(LOOPBACK_OUT, LOOPBACK_IN), "loopback", "failed through a closed switch");
+  check(sim.contention == 0, "loopback", "pins drove different levels through the switch");
+  setConnection(0b1000, 0, 0, false);
+  check(!ch446qVerifyLoopback(LOOPBACK_OUT, LOOPBACK_IN), "loopback", "passed through an open switch");
+  check(ch446qStats.verified == 1 && ch446qStats.verifyFailures == 1, "loopback", "results not counted");
+}
+
+void testDecodeChip(){
+  check(ch446qDecodeChip("1000") == 0b1000 && ch446qDecodeChip("0") == 0, "decode", "binary address");
+  check(ch446qDecodeChip("MUX1") == 0b1000 && ch446qDecodeChip("MUX2") == 0b1001, "decode", "MUX name");
+  const char *bad[] = {"MUX0", "MUX3", "MUX", "MUX10", "mux1", "10000", "12", ""};
+  for (const char *name : bad){
+    check(ch446qDecodeChip(name) == -1, "decode", name);
+  }
+  check(ch446qDecodeChip(NULL) == -1, "decode", "NULL");
+}
+
+int main(){
+  srand(1);
+  ch446qInit();
+
+  testApplyMatchesSetConnection();
+  testShadow();
+  testClear();
+  testApplyConfig();
+  testScheduler();
+  testStats();
+  testLoopback();
+  testDecodeChip();
+
+  printf("%s, %d failures\n", failures == 0 ? "PASS" : "FAIL", failures);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,14 @@
+// Second translation unit of driver_test, so the test only links when CH446Q.h can be included
+// from more than one file. Same configuration as driver_test.cpp.
+#define CH446Q_MUX_ADDRESSES {0b1000, 0b1001}
+#define CH446Q_STATS
+
+#include "../CH446Q.h"
+
+int secondUnitSetConnection(uint8_t addr, uint8_t x, uint8_t y, bool on){
+  return setConnection(addr, x, y, on);
+}
+
+uint16_t secondUnitClosedRow(uint8_t mux, uint8_t y){
+  return ch446qClosed[mux][y];
+}
@@ -1,82 +1,85 @@
 #include "Arduino.h"
+#define CH446Q_MUX_ADDRESSES {0b1111}
+#include <CH446Q.h>
 
-#define STB_PIN 12
-#define DAT_PIN 13
+#define SWITCH_BENCHMARK 0
 
-#define AY0_PIN 4
-#define AY1_PIN 2
-#define AY2_PIN 15
+// Set to 1 on a board with two spare GPIOs wired to X1 and Y1 of chip 0b1111, so setup() checks
+// the switch it closes. Off by default, setup() doesn't touch any other pin.
+#define LOOPBACK_CHECK 0
 
-#define AX0_PIN 18
-#define AX1_PIN 5
-#define AX2_PIN 17
-#define AX3_PIN 16
+#if LOOPBACK_CHECK
+#define LOOPBACK_OUT_PIN 25
+#define LOOPBACK_IN_PIN 26
+#endif
 
-#define ADDR0_PIN 19
-#define ADDR1_PIN 21
-#define ADDR2_PIN 22
-#define ADDR3_PIN 23
+#if SWITCH_BENCHMARK
+// setConnection the digitalWrite way, one call per line and a 2 us strobe
+void setConnectionDigitalWrite(uint8_t addr, uint8_t AX, uint8_t AY, bool mode) {
+  digitalWrite(ADDR0_PIN, addr & 0b0001);
+  digitalWrite(ADDR1_PIN, addr & 0b0010);
+  digitalWrite(ADDR2_PIN, addr & 0b0100);
+  digitalWrite(ADDR3_PIN, addr & 0b1000);
 
-#define MAX_ADDRESS 15
-#define MAX_AX 15
-#define MAX_AY 7
+  digitalWrite(AX0_PIN, AX & 0b0001);
+  digitalWrite(AX1_PIN, AX & 0b0010);
+  digitalWrite(AX2_PIN, AX & 0b0100);
+  digitalWrite(AX3_PIN, AX & 0b1000);
 
-void setupPins() {
-  pinMode(STB_PIN, OUTPUT);
-  pinMode(DAT_PIN, OUTPUT);
-
-  pinMode(AY0_PIN, OUTPUT);
-  pinMode(AY1_PIN, OUTPUT);
-  pinMode(AY2_PIN, OUTPUT);
-
-  pinMode(AX0_PIN, OUTPUT);
-  pinMode(AX1_PIN, OUTPUT);
-  pinMode(AX2_PIN, OUTPUT);
-  pinMode(AX3_PIN, OUTPUT);
-
-  pinMode(ADDR0_PIN, OUTPUT);
-  pinMode(ADDR1_PIN, OUTPUT);
-  pinMode(ADDR2_PIN, OUTPUT);
-  pinMode(ADDR3_PIN, OUTPUT);
-}
-
-int setConnection(uint8_t addr, uint8_t AX, uint8_t AY, bool mode) {
-  if (addr > MAX_ADDRESS || AX > MAX_AX || AY > MAX_AY) {
-    return -1;
-  }
-
-  // Set ADDR_PORT bits using digitalWrite
-  digitalWrite(ADDR0_PIN, 1);
-  digitalWrite(ADDR1_PIN, 1);
-  digitalWrite(ADDR2_PIN, 1);
-  digitalWrite(ADDR3_PIN, 1);
-
-  // Set AX_PORT bits using digitalWrite
-  digitalWrite(AX0_PIN, 1);
-  digitalWrite(AX1_PIN, 1);
-  digitalWrite(AX2_PIN, 0); 
-  digitalWrite(AX3_PIN, 0);
-
-  // Set AY_PORT bits using digitalWrite
-  digitalWrite(AY0_PIN, 0);
-  digitalWrite(AY1_PIN, 0);
-  digitalWrite(AY2_PIN, 0);
+  digitalWrite(AY0_PIN, AY & 0b0001);
+  digitalWrite(AY1_PIN, AY & 0b0010);
+  digitalWrite(AY2_PIN, AY & 0b0100);
 
   digitalWrite(DAT_PIN, mode);
 
-  digitalWrite(STB_PIN, HIGH);  // Set STB high
-
+  digitalWrite(STB_PIN, HIGH);
   delayMicroseconds(2);
+  digitalWrite(STB_PIN, LOW);
+}
 
-  digitalWrite(STB_PIN, LOW);  // Set STB low
-
-  return 1;
+// Opens all switches of the fitted chips both ways
+void switchBenchmark() {
+  unsigned long start = micros();
+  for (uint8_t mux = 0; mux < CH446Q_MUXES; mux++) {
+    for (uint8_t x = 0; x < 16; x++) {
+      for (uint8_t y = 0; y < 8; y++) {
+        setConnectionDigitalWrite(ch446qMuxAddresses[mux], x, y, false);
+      }
+    }
+  }
+  unsigned long digital = micros() - start;
+
+  start = micros();
+  for (uint8_t mux = 0; mux < CH446Q_MUXES; mux++) {
+    for (uint8_t x = 0; x < 16; x++) {
+      for (uint8_t y = 0; y < 8; y++) {
+        setConnection(ch446qMuxAddresses[mux], x, y, false);
+      }
+    }
+  }
+  unsigned long registers = micros() - start;
+
+  Serial.print(CH446Q_MUXES * 128);
+  Serial.print(" switches: digitalWrite ");
+  Serial.print(digital);
+  Serial.print(" us, GPIO_OUT_W1TS/W1TC ");
+  Serial.print(registers);
+  Serial.println(" us");
 }
+#endif
 
 void setup() {
   Serial.begin(9600);
-  setupPins();
+  ch446qInit();
+#if SWITCH_BENCHMARK
+  switchBenchmark();
+#endif
   setConnection(0b1111, 1, 1, true);
+
+#if LOOPBACK_CHECK
+  Serial.print("Loopback X1-Y1: ");
+  Serial.println(ch446qVerifyLoopback(LOOPBACK_OUT_PIN, LOOPBACK_IN_PIN) ? "ok" : "failed");
+#endif
 }
 
 void loop() {
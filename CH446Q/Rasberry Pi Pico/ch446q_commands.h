@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "ch446q_masks.h"
+
+// The PIO program outputs GPIO 0-12 straight from the command bits
+static_assert((ch446qMasks.all & ~0x1FFFu) == 0, "The PIO driver needs every CH446Q line on GPIO 0-12");
+
+#ifndef CH446Q_PIO_BATCH
+#define CH446Q_PIO_BATCH 256 // Enough to clear two chips in one transfer
+#endif
+
+static_assert(CH446Q_PIO_BATCH % 2 == 0, "Commands are sent two per FIFO word");
+
+// Switch commands for the PIO driver: 16 bits each, the GPIO levels of one switch,
+// packed two per 32 bit word in the order the state machine shifts them out.
+struct CH446QPioBatch {
+    alignas(4) uint16_t commands[CH446Q_PIO_BATCH];
+    uint16_t count = 0;
+
+    // Returns false when the batch is full or the switch is out of range
+    bool add(uint8_t addr, uint8_t AX, uint8_t AY, bool mode) {
+        if (count == CH446Q_PIO_BATCH || addr > MAX_ADDRESS || AX > MAX_AX || AY > MAX_AY) {
+            return false;
+        }
+        commands[count++] = (uint16_t)ch446qMasks.value(addr, AX, AY, mode);
+        return true;
+    }
+
+    // Number of FIFO words. An odd batch is padded with its last command again,
+    // which only strobes the same switch to the same state twice.
+    uint16_t words() {
+        if (count % 2 != 0) {
+            commands[count] = commands[count - 1];
+        }
+        return (count + 1) / 2;
+    }
+
+    const uint32_t *data() const {
+        return reinterpret_cast<const uint32_t *>(commands);
+    }
+};
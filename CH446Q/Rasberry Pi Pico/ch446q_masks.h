@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+
+// GPIO wiring of the CH446Q, one GPIO number per input
+#define ADDR0 9
+#define ADDR1 10
+#define ADDR2 11
+#define ADDR3 12
+
+#define AY0 4
+#define AY1 5
+#define AY2 6
+
+#define AX0 0
+#define AX1 1
+#define AX2 2
+#define AX3 3
+
+#define STB 8
+#define DAT 7
+
+#define MAX_ADDRESS 15
+#define MAX_AX 15
+#define MAX_AY 7
+
+// Output values of every possible chip address, AX and AY, worked out once so that
+// setConnection can drive all 12 data lines with a single gpio_put_masked() write.
+// Only the SIO bit positions live here, no SDK calls, so the tables can be checked on the host.
+struct CH446QMasks {
+    uint32_t addr[16];
+    uint32_t ax[16];
+    uint32_t ay[8];
+    uint32_t dat;
+    uint32_t stb;
+    uint32_t data; // Every line set up before the strobe: ADDR, AX, AY and DAT
+    uint32_t all;  // data and STB, for gpio_init_mask / gpio_set_dir_out_masked
+
+    constexpr CH446QMasks(const uint8_t addrPins[4], const uint8_t axPins[4], const uint8_t ayPins[3], uint8_t datPin, uint8_t stbPin)
+        : addr(), ax(), ay(), dat(1u << datPin), stb(1u << stbPin), data(0), all(0) {
+        for (int value = 0; value < 16; value++) {
+            for (int bit = 0; bit < 4; bit++) {
+                if (value & (1 << bit)) {
+                    addr[value] |= 1u << addrPins[bit];
+                    ax[value] |= 1u << axPins[bit];
+                }
+            }
+        }
+        for (int value = 0; value < 8; value++) {
+            for (int bit = 0; bit < 3; bit++) {
+                if (value & (1 << bit)) {
+                    ay[value] |= 1u << ayPins[bit];
+                }
+            }
+        }
+        data = addr[15] | ax[15] | ay[7] | dat;
+        all = data | stb;
+    }
+
+    // Levels of the data lines for one switch, to be written under the data mask
+    constexpr uint32_t value(uint8_t address, uint8_t x, uint8_t y, bool on) const {
+        return addr[address & 15] | ax[x & 15] | ay[y & 7] | (on ? dat : 0);
+    }
+};
+
+constexpr uint8_t ch446qAddrPins[4] = {ADDR0, ADDR1, ADDR2, ADDR3};
+constexpr uint8_t ch446qAxPins[4] = {AX0, AX1, AX2, AX3};
+constexpr uint8_t ch446qAyPins[3] = {AY0, AY1, AY2};
+
+constexpr CH446QMasks ch446qMasks(ch446qAddrPins, ch446qAxPins, ch446qAyPins, DAT, STB);
+
+static_assert((ch446qMasks.data & ch446qMasks.stb) == 0, "STB shares a GPIO with a data line");
+static_assert(__builtin_popcount(ch446qMasks.all) == 13, "Two CH446Q inputs are wired to the same GPIO");
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+
+#include "ch446q_commands.h"
+#include "ch446q.pio.h"
+
+// Length of one PIO cycle: setup and hold are 2 cycles, the STB pulse 4 (100 ns at the default)
+#ifndef CH446Q_PIO_CYCLE_NS
+#define CH446Q_PIO_CYCLE_NS 25
+#endif
+
+// PIO driver: a DMA channel feeds batches into the TX FIFO and the state machine makes the
+// waveforms, so the CPU only packs commands and is free while a batch goes out.
+struct CH446QPio {
+    PIO pio;
+    uint sm;
+    int dma;
+};
+
+// Driver state, defined once however many files include this header
+template <class = void>
+struct CH446QPioState {
+    static CH446QPio pio;
+};
+
+template <class T> CH446QPio CH446QPioState<T>::pio;
+
+static CH446QPio &ch446qPio = CH446QPioState<>::pio;
+
+inline void ch446qPioInit(PIO pio) {
+    ch446qPio.pio = pio;
+    ch446qPio.sm = pio_claim_unused_sm(pio, true);
+    uint offset = pio_add_program(pio, &ch446q_program);
+    ch446q_program_init(pio, ch446qPio.sm, offset, STB, CH446Q_PIO_CYCLE_NS);
+
+    ch446qPio.dma = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(ch446qPio.dma);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, ch446qPio.sm, true));
+    dma_channel_configure(ch446qPio.dma, &c, &pio->txf[ch446qPio.sm], nullptr, 0, false);
+}
+
+// True until every command handed to the DMA has been strobed
+inline bool ch446qPioBusy() {
+    if (dma_channel_is_busy(ch446qPio.dma) || !pio_sm_is_tx_fifo_empty(ch446qPio.pio, ch446qPio.sm)) {
+        return true;
+    }
+    // The FIFO is empty, the last word is done once the state machine stalls on the next pull
+    uint32_t stalled = 1u << (PIO_FDEBUG_TXSTALL_LSB + ch446qPio.sm);
+    ch446qPio.pio->fdebug = stalled;
+    return (ch446qPio.pio->fdebug & stalled) == 0;
+}
+
+// Starts sending a batch and returns straight away. The batch must stay untouched
+// until ch446qPioBusy() is false.
+inline void ch446qPioSend(CH446QPioBatch &batch) {
+    while (ch446qPioBusy()) {
+        tight_loop_contents();
+    }
+    if (batch.count == 0) {
+        return;
+    }
+    dma_channel_transfer_from_buffer_now(ch446qPio.dma, batch.data(), batch.words());
+}
@@ -0,0 +1,95 @@
+// Host test of the GPIO masks in ch446q_masks.h, no Pico SDK needed.
+// Every (addr, AX, AY, DAT) value is compared with the pin levels the old per-pin
+// gpio_put() sequence produced.
+//
+// Build and run from this directory:
+//   g++ -std=c++14 mask_test.cpp -o mask_test && ./mask_test
+#include <stdio.h>
+
+#include "ch446q_masks.h"
+
+// The old setConnection, one gpio_put per line, into a GPIO level word
+uint32_t perPinLevels(uint8_t addr, uint8_t AX, uint8_t AY, bool mode) {
+    uint32_t levels = 0;
+    auto put = [&levels](int gpio, bool value) {
+        if (value) {
+            levels |= 1u << gpio;
+        }
+    };
+
+    put(ADDR0, (addr & 0b0001));
+    put(ADDR1, (addr & 0b0010));
+    put(ADDR2, (addr & 0b0100));
+    put(ADDR3, (addr & 0b1000));
+
+    put(AX0, (AX & 0b0001));
+    put(AX1, (AX & 0b0010));
+    put(AX2, (AX & 0b0100));
+    put(AX3, (AX & 0b1000));
+
+    put(AY0, (AY & 0b0001));
+    put(AY1, (AY & 0b0010));
+    put(AY2, (AY & 0b0100));
+
+    put(DAT, mode);
+    return levels;
+}
+
+int checkMasks(const CH446QMasks &masks, const char *name, uint32_t (*reference)(uint8_t, uint8_t, uint8_t, bool)) {
+    int failures = 0;
+    for (int addr = 0; addr <= MAX_ADDRESS; addr++) {
+        for (int x = 0; x <= MAX_AX; x++) {
+            for (int y = 0; y <= MAX_AY; y++) {
+                for (int on = 0; on < 2; on++) {
+                    uint32_t value = masks.value(addr, x, y, on);
+                    uint32_t expected = reference(addr, x, y, on);
+                    if (value != expected || (value & ~masks.data) != 0) {
+                        if (failures < 10) {
+                            printf("%s: addr %d x %d y %d on %d: 0x%08X, expected 0x%08X\n", name, addr, x, y, on, value, expected);
+                        }
+                        failures++;
+                    }
+                }
+            }
+        }
+    }
+    return failures;
+}
+
+// A scrambled wiring, so a mask builder that only works for neighbouring pins would fail
+const uint8_t scrambledAddr[4] = {28, 3, 17, 9};
+const uint8_t scrambledAx[4] = {0, 22, 5, 14};
+const uint8_t scrambledAy[3] = {26, 1, 12};
+const uint8_t scrambledDat = 20;
+const uint8_t scrambledStb = 7;
+
+uint32_t scrambledLevels(uint8_t addr, uint8_t AX, uint8_t AY, bool mode) {
+    uint32_t levels = mode ? 1u << scrambledDat : 0;
+    for (int bit = 0; bit < 4; bit++) {
+        levels |= ((addr >> bit) & 1u) << scrambledAddr[bit];
+        levels |= ((AX >> bit) & 1u) << scrambledAx[bit];
+    }
+    for (int bit = 0; bit < 3; bit++) {
+        levels |= ((AY >> bit) & 1u) << scrambledAy[bit];
+    }
+    return levels;
+}
+
+int main() {
+    int failures = checkMasks(ch446qMasks, "board wiring", perPinLevels);
+    if (ch446qMasks.data != 0x1EFFu || ch446qMasks.stb != 1u << STB) {
+        printf("board wiring: data mask 0x%08X, STB mask 0x%08X\n", ch446qMasks.data, ch446qMasks.stb);
+        failures++;
+    }
+
+    CH446QMasks scrambled(scrambledAddr, scrambledAx, scrambledAy, scrambledDat, scrambledStb);
+    failures += checkMasks(scrambled, "scrambled wiring", scrambledLevels);
+    if ((scrambled.all & scrambled.stb) == 0 || (scrambled.data & scrambled.stb) != 0) {
+        printf("scrambled wiring: STB not in the right mask\n");
+        failures++;
+    }
+
+    printf("%s, %d mismatches in %d switch values per wiring\n", failures == 0 ? "PASS" : "FAIL", failures,
+           (MAX_ADDRESS + 1) * (MAX_AX + 1) * (MAX_AY + 1) * 2);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+// Host test of the PIO driver, no Pico SDK needed. A cycle by cycle model of one RP2040 state
+// machine runs the ch446q program on batches packed by CH446QPioBatch, then the GPIO trace is
+// decoded back into switch operations and the strobe timing is checked.
+//
+// Build and run from this directory:
+//   g++ -std=c++14 pio_test.cpp -o pio_test && ./pio_test
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <deque>
+
+#include "ch446q_commands.h"
+
+using namespace std;
+
+// ch446q_program_instructions as pioasm assembles ch446q.pio (.side_set 1, not optional)
+const uint16_t programInstructions[] = {
+    0x610d, //  0: out    pins, 13        side 0 [1]
+    0x7363, //  1: out    null, 3         side 1 [3]
+    0xa142, //  2: nop                    side 0 [1]
+};
+const int PROGRAM_LENGTH = sizeof(programInstructions) / sizeof(programInstructions[0]);
+
+// Setup, STB high and hold time in state machine cycles, as ch446q.pio promises
+const int SETUP_CYCLES = 2;
+const int STROBE_CYCLES = 4;
+const int HOLD_CYCLES = 2;
+
+// The parts of a state machine the program uses: OUT to pins / null with autopull (shift right,
+// threshold 32), NOP, one mandatory side-set bit and delays. Anything else fails the test.
+struct StateMachine {
+    deque<uint32_t> fifo;
+    uint32_t osr = 0;
+    int shiftCount = 32; // Empty, the first OUT pulls
+    int pc = 0;
+    int delay = 0;
+    uint32_t pins = 0;
+    int outBase = 0, outCount = 13, sidePin = STB;
+    bool stalled = false;
+    bool bad = false;
+
+    void step() {
+        if (delay > 0) {
+            delay--;
+            return;
+        }
+        uint16_t instr = programInstructions[pc];
+        int opcode = instr >> 13;
+        int side = (instr >> 12) & 1;
+        int instrDelay = (instr >> 8) & 0xF;
+
+        // Side-set happens at the start of the instruction, also when it stalls
+        pins = (pins & ~(1u << sidePin)) | ((uint32_t)side << sidePin);
+
+        if (opcode == 3) { // OUT
+            int destination = (instr >> 5) & 7;
+            int bits = instr & 0x1F;
+            if (shiftCount >= 32) {
+                if (fifo.empty()) {
+                    stalled = true;
+                    return;
+                }
+                osr = fifo.front();
+                fifo.pop_front();
+                shiftCount = 0;
+            }
+            uint32_t value = osr & ((1u << bits) - 1);
+            osr >>= bits;
+            shiftCount += bits;
+            if (destination == 0) { // PINS
+                uint32_t mask = ((1u << outCount) - 1) << outBase;
+                mask &= ~(1u << sidePin); // Side-set wins over OUT on the same pin
+                pins = (pins & ~mask) | ((value << outBase) & mask);
+            } else if (destination != 3) { // NULL
+                bad = true;
+            }
+        } else if ((instr & ~0x1F00) != 0xa042) { // Only MOV Y, Y (NOP)
+            bad = true;
+        }
+        stalled = false;
+        delay = instrDelay;
+        pc = (pc + 1) % PROGRAM_LENGTH; // .wrap at the end of the program
+    }
+};
+
+struct SwitchOp {
+    int addr, x, y, on;
+};
+
+// Inverse of ch446qMasks.value(), -1 when the levels match no value of a field
+int decodeField(uint32_t levels, const uint32_t *table, int size) {
+    for (int value = 0; value < size; value++) {
+        if ((levels & table[size - 1]) == table[value]) {
+            return value;
+        }
+    }
+    return -1;
+}
+
+// Runs the batch through the state machine until it idles and decodes every STB pulse.
+// Timing errors are counted into timingErrors.
+vector<SwitchOp> runBatch(CH446QPioBatch &batch, int &timingErrors) {
+    StateMachine sm;
+    uint16_t words = batch.words();
+    for (int i = 0; i < words; i++) {
+        sm.fifo.push_back(batch.data()[i]);
+    }
+
+    vector<uint32_t> trace;
+    for (int cycle = 0; cycle < 100000 && !(sm.stalled && sm.fifo.empty()); cycle++) {
+        sm.step();
+        trace.push_back(sm.pins);
+    }
+    if (sm.bad) {
+        timingErrors++;
+    }
+
+    vector<SwitchOp> ops;
+    uint32_t stb = ch446qMasks.stb, data = ch446qMasks.data;
+    for (size_t t = 0; t < trace.size(); t++) {
+        bool rising = (trace[t] & stb) && (t == 0 || !(trace[t - 1] & stb));
+        if (!rising) {
+            continue;
+        }
+        // Data stable for SETUP_CYCLES before the rising edge, through the pulse and HOLD_CYCLES after it
+        size_t high = t;
+        while (high < trace.size() && (trace[high] & stb)) {
+            high++;
+        }
+        if ((int)(high - t) != STROBE_CYCLES || t < (size_t)SETUP_CYCLES) {
+            timingErrors++;
+        }
+        for (size_t c = t - min(t, (size_t)SETUP_CYCLES); c < min(trace.size(), high + HOLD_CYCLES); c++) {
+            if ((trace[c] & data) != (trace[t] & data)) {
+                timingErrors++;
+                break;
+            }
+        }
+        uint32_t levels = trace[t];
+        ops.push_back(SwitchOp{decodeField(levels, ch446qMasks.addr, 16), decodeField(levels, ch446qMasks.ax, 16),
+                               decodeField(levels, ch446qMasks.ay, 8), (levels & ch446qMasks.dat) ? 1 : 0});
+    }
+    return ops;
+}
+
+int main() {
+    srand(1);
+    int failures = 0, timingErrors = 0, strobes = 0;
+    for (int round = 0; round < 300; round++) {
+        CH446QPioBatch batch;
+        vector<SwitchOp> expected;
+        int count = round == 0 ? CH446Q_PIO_BATCH : 1 + rand() % 40;
+        for (int i = 0; i < count; i++) {
+            SwitchOp op{rand() % 16, rand() % 16, rand() % 8, rand() % 2};
+            if (!batch.add(op.addr, op.x, op.y, op.on)) {
+                failures++;
+            }
+            expected.push_back(op);
+        }
+        if (count % 2 != 0) {
+            expected.push_back(expected.back()); // The padding command
+        }
+        if (round == 0 && batch.add(0, 0, 0, true)) {
+            failures++; // A full batch must refuse more
+        }
+
+        vector<SwitchOp> ops = runBatch(batch, timingErrors);
+        strobes += (int)ops.size();
+        bool same = ops.size() == expected.size();
+        for (size_t i = 0; same && i < ops.size(); i++) {
+            same = memcmp(&ops[i], &expected[i], sizeof(SwitchOp)) == 0;
+        }
+        if (!same) {
+            if (failures < 5) {
+                printf("round %d: %d strobes decoded, %d expected\n", round, (int)ops.size(), (int)expected.size());
+            }
+            failures++;
+        }
+    }
+
+    CH446QPioBatch rangeCheck;
+    if (rangeCheck.add(16, 0, 0, true) || rangeCheck.add(0, 16, 0, true) || rangeCheck.add(0, 0, 8, true)) {
+        failures++;
+    }
+
+    printf("%s, %d strobes decoded, %d batch mismatches, %d timing errors\n",
+           failures + timingErrors == 0 ? "PASS" : "FAIL", strobes, failures, timingErrors);
+    return failures + timingErrors == 0 ? 0 : 1;
+}
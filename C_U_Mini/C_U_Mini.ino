@@ -1,132 +1,108 @@
 #include "Arduino.h"
 // #include "pathfindingtest.h"
+#define CH446Q_MUX_ADDRESSES {0b1000, 0b1001} // MUX1, MUX2
+#include <CH446Q.h>
+#include "pathfinding.h"
 
-#define STB (1 << PORTB3)
-#define STB_DDR (1 << DDB3)
-
-#define DAT (1 << PORTB4)
-#define DAT_DDR (1 << DDB4)
-
-#define AY0 (1 << PORTB0) 
-#define AY1 (1 << PORTB1)
-#define AY2 (1 << PORTB2)
-
-#define AY0_DDR (1 << DDB0)
-#define AY1_DDR (1 << DDB1)
-#define AY2_DDR (1 << DDB2)
-
-#define AX0 (1 << PORTC0) //A0
-#define AX1 (1 << PORTC1) //A1
-#define AX2 (1 << PORTC2) //A2
-#define AX3 (1 << PORTC3) //A3
-
-#define AX0_DDR (1 << DDC0) //A0
-#define AX1_DDR (1 << DDC1) //A1
-#define AX2_DDR (1 << DDC2) //A2
-#define AX3_DDR (1 << DDC3) //A3
-
-#define AX_PORT PORTC
-#define AY_PORT PORTB
-#define CONTROL_PORT PORTB
-
-#define AX_PORT_DDR DDRC
-#define AY_PORT_DDR DDRB 
-#define CONTROL_PORT_DDR DDRB
-
-#define ADDR0 (1 << PORTD4)
-#define ADDR1 (1 << PORTD5)
-#define ADDR2 (1 << PORTD6)
-#define ADDR3 (1 << PORTD7)
-
-#define ADDR0_DDR (1 << DDD4)
-#define ADDR1_DDR (1 << DDD5)
-#define ADDR2_DDR (1 << DDD6)
-#define ADDR3_DDR (1 << DDD7)
-
-#define ADDR_PORT PORTD
-#define ADDR_PORT_DDR DDRD
-
-#define MAX_ADDRESS 15 // change later
-#define MAX_AX 15 // 2^n -1
-#define MAX_AY 7
-
-int setConnection(uint8_t addr, uint8_t AX, uint8_t AY, bool mode){
-  if (addr > MAX_ADDRESS || AX > MAX_AX || AY > MAX_AY){
-    return -1;
-  }
-
-  ADDR_PORT = (ADDR_PORT & 0x0F) | (addr << 4); /// pazq starta stojnost na 4-te bita koito ne iskam da pipam i zadavam nova stojnost na 4 bita, kojto promenqm
-
-  AX_PORT = (AX_PORT & 0xF0) | AX;
-
-  AY_PORT = (AY_PORT & 0xF8) | AY; 
-
-  if (mode){
-    CONTROL_PORT |= DAT;
-  }else{
-    CONTROL_PORT &= ~DAT;
-  }
-
-  CONTROL_PORT |= STB;
-
-  delayMicroseconds(2);
-
-  CONTROL_PORT &= ~STB;
-
-  return 1;
-} 
-
+// CH446Q address of a route table chip, MUX1 -> 1000    MUX2 -> 1001
+uint8_t muxAddress(uint8_t chip){
+    return chip == 0 ? 0b1000 : 0b1001;
+}
 
 void setup(){
     Serial.begin(9600);
 
-    ADDR_PORT_DDR |= ADDR0_DDR | ADDR1_DDR | ADDR2_DDR | ADDR3_DDR; // Init D Port Arduino
-
-    ADDR_PORT &= ~(ADDR0 | ADDR1 | ADDR2 | ADDR3);
-
-
-    AY_PORT_DDR |= AY0_DDR | AY1_DDR | AY2_DDR;// Init B Port Arduino
-
-    AY_PORT &= ~(AY0 | AY1 | AY2);
-
+    ch446qInit();
+    clearRoutes();
 
-    AX_PORT_DDR |= AX0_DDR | AX1_DDR | AX2_DDR | AX3_DDR;// Init C Port Arduino
+    // All connections of the demo circuit in one batch
+    CH446QOp ops[] = {
+        // LED
 
-    AX_PORT &= ~(AX0 | AX1 | AX2 | AX3);
+        // 2 breadboard -> 4 mcu: (GND)
+        {0b1001, 4, 0, true},
+        {0b1000, 0, 3, true},
 
+        // 11 breadboard -> 5 mcu: (P0)
+        {0b1001, 14, 1, true},
+        {0b1000, 1, 4, true},
 
-    CONTROL_PORT_DDR |= STB_DDR | DAT_DDR;
+        // Potentiometer
 
-    CONTROL_PORT |= DAT;
-    CONTROL_PORT &= ~STB;
+        // 14 breadboard -> 4 mcu: (GND)
+        {0b1000, 9, 3, true},
 
-    // LED
-
-    // 2 breadboard -> 4 mcu: (GND)
-    setConnection(0b1001, 4, 0, true); 
-    setConnection(0b1000, 0, 3, true); 
-
-    // 11 breadboard -> 5 mcu: (P0)
-    setConnection(0b1001, 14, 1, true); 
-    setConnection(0b1000, 1, 4, true); 
-
-    // Potentiometer
-
-    // 14 breadboard -> 4 mcu: (GND)
-    setConnection(0b1000, 9, 3, true); 
-
-    // 16 breadboard -> 2 mcu: (P3)
-    setConnection(0b1000, 11, 1, true); 
-
-    // 18 breadboard -> 2 mcu: (VCC)
-    setConnection(0b1000, 13, 7, true); 
-
-    
+        // 16 breadboard -> 2 mcu: (P3)
+        {0b1000, 11, 1, true},
 
+        // 18 breadboard -> 2 mcu: (VCC)
+        {0b1000, 13, 7, true},
+    };
+    ch446qApply(ops, sizeof(ops) / sizeof(ops[0]));
 
+    // Keep findRoute off the pins the demo circuit holds
+    for (const CH446QOp &op : ops){
+        MuxSwitch held = {(uint8_t)(op.addr == muxAddress(0) ? 0 : 1), op.x, op.y};
+        reserveRoute(&held, 1);
+    }
+}
 
+// Longest command line, "23 7" with room for extra spaces and a '\r'
+#define COMMAND_LINE_SIZE 16
+
+// Reads the two numbers of a "<MainBreadboard pin> <MCUBreadboard pin>" line. False when the line
+// holds anything else, so a timeout or stray character never reads as pin 0.
+bool parsePinPair(const char *line, long &mainBreadboardPin, long &mcuBreadboardPin){
+    char *end;
+    mainBreadboardPin = strtol(line, &end, 10);
+    if (end == line){
+        return false;
+    }
+    const char *rest = end;
+    mcuBreadboardPin = strtol(rest, &end, 10);
+    if (end == rest){
+        return false;
+    }
+    while (*end == ' ' || *end == '\r'){
+        end++;
+    }
+    return *end == '\0';
 }
 
+// A "<MainBreadboard pin> <MCUBreadboard pin>" line on Serial connects the two through the first
+// free route of route_table.h and prints it
 void loop(){
-    
+    if (Serial.available() == 0){
+        return;
+    }
+    char line[COMMAND_LINE_SIZE];
+    size_t length = Serial.readBytesUntil('\n', line, sizeof(line) - 1);
+    line[length] = '\0';
+    if (length == 0 || (length == 1 && line[0] == '\r')){
+        return; // Empty line
+    }
+
+    long mainBreadboardPin, mcuBreadboardPin;
+    if (!parsePinPair(line, mainBreadboardPin, mcuBreadboardPin)){
+        Serial.println("expected <main pin> <mcu pin>");
+        return;
+    }
+    if (mainBreadboardPin < 0 || mainBreadboardPin >= ROUTE_TABLE_MAIN_PINS || mcuBreadboardPin < 0 || mcuBreadboardPin >= ROUTE_TABLE_MCU_PINS){
+        Serial.println("no such pin");
+        return;
+    }
+
+    MuxSwitch route[ROUTE_MAX_SWITCHES];
+    uint8_t switches = findRoute(mainBreadboardPin, mcuBreadboardPin, route);
+    if (switches == 0){
+        Serial.println("no free route");
+        return;
+    }
+
+    CH446QOp ops[ROUTE_MAX_SWITCHES];
+    for (uint8_t i = 0; i < switches; i++){
+        ops[i] = {muxAddress(route[i].chip), route[i].x, route[i].y, true};
+    }
+    ch446qApply(ops, switches);
+    printRoute(mainBreadboardPin, mcuBreadboardPin, route, switches);
 }
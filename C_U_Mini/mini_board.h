@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM // Host builds read the table directly
+#endif
+
+// Wiring of the mini board: MUX1 and MUX2 (CH446Q 1000 and 1001), MainBreadboard pins 0-23 and
+// MCUBreadboard pins 0-7. The firmware (pathfinding.h), the host BFS (pathfinding.cpp) and
+// PathfindingMUX/mini_scheme/generate_route_table.cpp all read it from here; regenerate
+// route_table.h after changing it.
+
+// Vertex numbering of the mini board, usable in constant expressions
+constexpr uint8_t muxX(uint8_t mux, uint8_t x) { return mux * 24 + x; }
+constexpr uint8_t muxY(uint8_t mux, uint8_t y) { return mux * 24 + 16 + y; }
+constexpr uint8_t mainPin(uint8_t pin) { return 2 * 24 + pin; }
+constexpr uint8_t mcuPin(uint8_t pin) { return 2 * 24 + 24 + pin; }
+
+const int MINI_VERTICES = 2 * 24 + 1 * 24 + 1 * 8;
+
+// Board wires of the mini scheme, one vertex pair per wire, kept in flash on the board.
+// Every X to Y connection inside a MUX is implied and not listed.
+const uint8_t miniBoardWires[][2] PROGMEM = {
+    // MUX1 pins edge connections FIXED
+    {muxX(0, 0), muxY(1, 0)}, {muxX(0, 1), muxY(1, 1)}, {muxX(0, 2), muxY(1, 2)}, {muxX(0, 3), muxY(1, 3)},
+    {muxX(0, 4), muxY(1, 4)}, {muxX(0, 5), muxY(1, 5)}, {muxX(0, 6), muxY(1, 6)}, {muxX(0, 7), muxY(1, 7)},
+    {muxX(0, 8), mainPin(12)}, {muxX(0, 9), mainPin(13)}, {muxX(0, 10), mainPin(14)}, {muxX(0, 11), mainPin(15)},
+    {muxX(0, 12), mainPin(16)}, {muxX(0, 13), mainPin(17)}, {muxX(0, 14), mainPin(18)}, {muxX(0, 15), mainPin(19)},
+
+    {muxY(0, 0), mcuPin(0)}, {muxY(0, 1), mcuPin(1)}, {muxY(0, 2), mcuPin(2)}, {muxY(0, 3), mcuPin(3)},
+    {muxY(0, 4), mcuPin(4)}, {muxY(0, 5), mcuPin(5)}, {muxY(0, 6), mcuPin(6)}, {muxY(0, 7), mcuPin(7)},
+
+    // MUX2 pins edge connections FIXED
+    {muxX(1, 0), mainPin(20)}, {muxX(1, 1), mainPin(21)}, {muxX(1, 2), mainPin(22)}, {muxX(1, 3), mainPin(23)},
+    {muxX(1, 4), mainPin(0)}, {muxX(1, 5), mainPin(1)}, {muxX(1, 6), mainPin(2)}, {muxX(1, 7), mainPin(3)},
+    {muxX(1, 8), mainPin(4)}, {muxX(1, 9), mainPin(5)}, {muxX(1, 10), mainPin(6)}, {muxX(1, 11), mainPin(7)},
+    {muxX(1, 12), mainPin(8)}, {muxX(1, 13), mainPin(9)}, {muxX(1, 14), mainPin(10)}, {muxX(1, 15), mainPin(11)},
+};
@@ -6,6 +6,7 @@
 #include <fstream>
 #include <string>
 #include <cstdio>
+#include "mini_board.h"
 
 using namespace std;
 
@@ -305,7 +306,7 @@ int main() // initPathfinding
 
     Multiplexer all_muxes[2] = {mux1, mux2};
 
-    int numVertices = 2 * 24 + 1 * 24 + 1 * 8;
+    int numVertices = MINI_VERTICES;
     Graph g(numVertices);
 
     // Add edges to the graph every X to Y connection in the muxes
@@ -322,50 +323,11 @@ int main() // initPathfinding
         }
     }
 
-    // MUX1 pins edge connections FIXED
-    g.addEdge(getGraphVertexID(&mux1, 'x', 0), getGraphVertexID(&mux2, 'y', 0));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 1), getGraphVertexID(&mux2, 'y', 1));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 2), getGraphVertexID(&mux2, 'y', 2));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 3), getGraphVertexID(&mux2, 'y', 3));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 4), getGraphVertexID(&mux2, 'y', 4));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 5), getGraphVertexID(&mux2, 'y', 5));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 6), getGraphVertexID(&mux2, 'y', 6));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 7), getGraphVertexID(&mux2, 'y', 7));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 8), getGraphVertexID(&main_breadboard, 'p', 12));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 9), getGraphVertexID(&main_breadboard, 'p', 13));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 10), getGraphVertexID(&main_breadboard, 'p', 14));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 11), getGraphVertexID(&main_breadboard, 'p', 15));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 12), getGraphVertexID(&main_breadboard, 'p', 16));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 13), getGraphVertexID(&main_breadboard, 'p', 17));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 14), getGraphVertexID(&main_breadboard, 'p', 18));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 15), getGraphVertexID(&main_breadboard, 'p', 19));
-
-    g.addEdge(getGraphVertexID(&mux1, 'y', 0), getGraphVertexID(&mcu_breadboard, 'p', 0));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 1), getGraphVertexID(&mcu_breadboard, 'p', 1));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 2), getGraphVertexID(&mcu_breadboard, 'p', 2));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 3), getGraphVertexID(&mcu_breadboard, 'p', 3));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 4), getGraphVertexID(&mcu_breadboard, 'p', 4));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 5), getGraphVertexID(&mcu_breadboard, 'p', 5));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 6), getGraphVertexID(&mcu_breadboard, 'p', 6));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 7), getGraphVertexID(&mcu_breadboard, 'p', 7));
-
-    // MUX2 pins edge connections FIXED
-    g.addEdge(getGraphVertexID(&mux2, 'x', 0), getGraphVertexID(&main_breadboard, 'p', 20));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 1), getGraphVertexID(&main_breadboard, 'p', 21));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 2), getGraphVertexID(&main_breadboard, 'p', 22));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 3), getGraphVertexID(&main_breadboard, 'p', 23));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 4), getGraphVertexID(&main_breadboard, 'p', 0));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 5), getGraphVertexID(&main_breadboard, 'p', 1));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 6), getGraphVertexID(&main_breadboard, 'p', 2));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 7), getGraphVertexID(&main_breadboard, 'p', 3));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 8), getGraphVertexID(&main_breadboard, 'p', 4));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 9), getGraphVertexID(&main_breadboard, 'p', 5));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 10), getGraphVertexID(&main_breadboard, 'p', 6));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 11), getGraphVertexID(&main_breadboard, 'p', 7));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 12), getGraphVertexID(&main_breadboard, 'p', 8));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 13), getGraphVertexID(&main_breadboard, 'p', 9));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 14), getGraphVertexID(&main_breadboard, 'p', 10));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 15), getGraphVertexID(&main_breadboard, 'p', 11));
+    // Board wires, the same mini_board.h table the firmware uses
+    for (const auto &wire : miniBoardWires)
+    {
+        g.addEdge(wire[0], wire[1]);
+    }
 
 
     vector<PathRequest> requests;
@@ -1,395 +1,178 @@
 #pragma once
 
-#include <StandardCplusplus.h>
-#include <iostream>
-#include <vector>
-#include <list>
-#include <queue>
-#include <algorithm>
-#include <sstream>
-#include <string>
 #include "Arduino.h"
+#include "mini_board.h"
+#include "route_table.h"
 
-using namespace std;
+// Longest vertex label (" -> MainBreadboard 23 ") plus the terminating NUL
+const int VERTEX_LABEL_SIZE = 24;
 
-enum DeviceType
+// Copies text to out and returns the position after it
+char *appendLabelText(char *out, const char *text)
 {
-    DEVICE,
-    MULTIPLEXER,
-    BREADBOARD
-};
-
-class Device
-{
-public:
-    int num;
-    DeviceType type;
-
-    Device(int n, DeviceType t) : num(n), type(t) {}
-};
-
-class ConnectionNode
-{
-public:
-    Device *device;
-    int index;
-    char connectionType;
-
-    ConnectionNode(Device *d, int i, char type) : device(d), index(i), connectionType(type) {}
-};
-
-class Multiplexer : public Device
-{
-public:
-    ConnectionNode *x[16];
-    ConnectionNode *y[8];
-
-    Multiplexer(int n) : Device(n, MULTIPLEXER)
+    while (*text)
     {
-        for (auto &xi : x)
-            xi = nullptr;
-        for (auto &yi : y)
-            yi = nullptr;
+        *out++ = *text++;
     }
-};
+    return out;
+}
 
-class Breadboard : public Device
+// Writes the decimal digits of a small non-negative value to out and returns the position after them
+char *appendLabelNumber(char *out, int value)
 {
-public:
-    ConnectionNode *pin[24];
-
-    Breadboard(int n) : Device(n, BREADBOARD)
+    if (value >= 10)
     {
-        for (auto &pin : pin)
-            pin = nullptr;
+        *out++ = '0' + value / 10;
     }
-};
+    *out++ = '0' + value % 10;
+    return out;
+}
 
-class Graph
+// Writes the label of a vertex (" -> MUX1 x5 ", " -> MainBreadboard 12 ") into buffer, which must hold
+// VERTEX_LABEL_SIZE chars, and returns its length. No heap use, safe to call from the firmware loop.
+int formatVertexLabel(char *buffer, int vertexID)
 {
-public:
-    int numVertices;
-    list<int> *adjLists;
-    bool *visited;
-    bool *globalUsedPins;
-
-    Graph(int vertices) : numVertices(vertices), adjLists(new list<int>[vertices]), visited(new bool[vertices]()), globalUsedPins(new bool[vertices]())
+    char *out = buffer;
+    if (vertexID < mainPin(0))
     {
-        fill(visited, visited + vertices, false);
-        fill(globalUsedPins, globalUsedPins + vertices, false);
+        int pinIndex = vertexID % 24;
+        out = appendLabelText(out, " -> MUX");
+        out = appendLabelNumber(out, vertexID / 24 + 1);
+        *out++ = ' ';
+        *out++ = pinIndex < 16 ? 'x' : 'y';
+        out = appendLabelNumber(out, pinIndex < 16 ? pinIndex : pinIndex - 16);
     }
-
-    ~Graph()
+    else if (vertexID < mcuPin(0))
     {
-        delete[] adjLists;
-        delete[] visited;
-        delete[] globalUsedPins;
+        out = appendLabelText(out, " -> MainBreadboard ");
+        out = appendLabelNumber(out, vertexID - mainPin(0));
     }
-
-    void addEdge(int src, int dest)
+    else
     {
-        adjLists[src].push_back(dest);
-        adjLists[dest].push_back(src);
+        out = appendLabelText(out, " -> MCUBreadboard ");
+        out = appendLabelNumber(out, vertexID - mcuPin(0));
     }
+    *out++ = ' ';
+    *out = '\0';
+    return out - buffer;
+}
 
-    bool isSpecialPin(int pin)
-    {     
-        const int mainBreadboardStart = 2 * 24, mainBreadboardEnd = 2 * 24 + 23;
-        const int mcuBreadboardStart = 2 * 24 + 24, mcuBreadboardEnd = 2 * 24 + 31;
-        return (pin >= mainBreadboardStart && pin <= mainBreadboardEnd) || (pin >= mcuBreadboardStart && pin <= mcuBreadboardEnd);
-    }
-
-    vector<int> findPathBFS(int startVertex, int endVertex)
-    {
-        int parent[numVertices];
-        fill(parent, parent + numVertices, -1);
-        fill(visited, visited + numVertices, false);
-        queue<int> q;
-        vector<int> path;
-        visited[startVertex] = true;
-        q.push(startVertex);
-        bool found = false;
-
-        while (!q.empty() && !found)
-        {
-            int current = q.front();
-            q.pop();
-
-            for (int adjVertex : adjLists[current])
-            {
-                if (!visited[adjVertex] && (!globalUsedPins[adjVertex] || isSpecialPin(adjVertex)))
-                {
-                    parent[adjVertex] = current;
-                    visited[adjVertex] = true;
-                    q.push(adjVertex);
-
-                    if (adjVertex == endVertex)
-                    {
-                        found = true;
-                        break;
-                    }
-                }
-            }
-        }
-
-        if (!found)
-        {
-            // cout << "No path found between " << startVertex << " and " << endVertex << endl;
-            return path;
-        }
-
-        for (int at = endVertex; at != -1; at = parent[at])
-        {
-            path.push_back(at);
-            if (!isSpecialPin(at))
-            {
-                globalUsedPins[at] = true;
-            }
-        }
-        reverse(path.begin(), path.end());
-        return path;
-    }
+// One closed CH446Q crosspoint of a route, chip 0 is MUX1 (1000) and chip 1 is MUX2 (1001)
+struct MuxSwitch
+{
+    uint8_t chip;
+    uint8_t x;
+    uint8_t y;
 };
 
-int getGraphVertexID(const Device *device, char type, int pinIndex)
+// MUX pins held by routes from findRoute, numbered as muxX and muxY (chip * 24 + pin)
+uint16_t routeUsedPins[(2 * 24 + 15) / 16];
+
+bool isRoutePinUsed(int pin)
 {
-    int deviceId = device->num;
-    if (device->type == MULTIPLEXER)
-    {
-        return deviceId * 24 + (type == 'x' ? pinIndex : 16 + pinIndex);
-    }
-    else if (device->type == BREADBOARD)
-    {
-        if (deviceId == 3)
-        { // Main breadboard
-            return 2 * 24 + pinIndex;
-        }
-        else if (deviceId == 4)
-        { // MCU breadboard
-            return 2 * 24 + 24 + pinIndex;
-        }
-    }
-    return -1; // Error case
+    return (routeUsedPins[pin >> 4] >> (pin & 15)) & 1;
 }
 
-
-std::string printDeviceSpecifications(int vertexID)
+void setRoutePin(int pin, bool used)
 {
-    int numMultiplexers = 2;
-    int multiplexerPins = 24;
-    int mainBreadboardPins = 24;
-
-    if (vertexID < numMultiplexers * multiplexerPins)
-    {
-        // It's a multiplexer
-        int deviceId = vertexID / multiplexerPins;
-        int pinIndex = vertexID % multiplexerPins;
-        char type = pinIndex < 16 ? 'x' : 'y';
-        pinIndex = pinIndex < 16 ? pinIndex : pinIndex - 16; // Adjust pinIndex for 'y' type
+    if (used)
+        routeUsedPins[pin >> 4] |= (uint16_t)1 << (pin & 15);
+    else
+        routeUsedPins[pin >> 4] &= ~((uint16_t)1 << (pin & 15));
+}
 
-        std::stringstream ss;
-        ss << " -> MUX" << deviceId + 1 << " " << type << pinIndex << " ";
-        return ss.str();
-    }
-    else if (vertexID < numMultiplexers * multiplexerPins + mainBreadboardPins)
-    {
-        // It's the main breadboard
-        int pinIndex = vertexID - (numMultiplexers * multiplexerPins);
+void clearRoutes()
+{
+    for (auto &word : routeUsedPins)
+        word = 0;
+}
 
-        std::stringstream ss;
-        ss << " -> MainBreadboard " << pinIndex << " ";
-        return ss.str();
-    }
-    else
+// Marks the MUX pins of switches as held, for routes findRoute made and switches closed without it
+void reserveRoute(const MuxSwitch *route, uint8_t switches)
+{
+    for (uint8_t i = 0; i < switches; i++)
     {
-        // It's the MCU breadboard
-        int pinIndex = vertexID - (numMultiplexers * multiplexerPins + mainBreadboardPins);
-
-        std::stringstream ss;
-        ss << " -> MCUBreadboard " << pinIndex << " ";
-        return ss.str();
+        setRoutePin(route[i].chip * 24 + route[i].x, true);
+        setRoutePin(route[i].chip * 24 + 16 + route[i].y, true);
     }
 }
 
-void printMUXConections(const vector<int> &path)
+// Looks up the precomputed routes of route_table.h (fewest switches first) and reserves the first one
+// whose MUX pins are all free. Writes its switches to route and returns how many, 0 if every candidate is blocked.
+uint8_t findRoute(uint8_t mainBreadboardPin, uint8_t mcuBreadboardPin, MuxSwitch route[ROUTE_MAX_SWITCHES])
 {
-    // MUX1 -> 1000    MUX2 -> 1001
-    
-    vector<string> devices;
-    // cout << "\nAll MUX conections: \n";
-    for (int vertex : path)
+    if (mainBreadboardPin >= ROUTE_TABLE_MAIN_PINS || mcuBreadboardPin >= ROUTE_TABLE_MCU_PINS)
     {
-        string device = printDeviceSpecifications(vertex);
-        devices.push_back(device);
+        return 0;
     }
-    
-    for (int i = 0; i < devices.size() - 1; i++)
-    {
-        string device1 = devices[i];
-        string device2 = devices[i + 1];
-        string device1_substr = devices[i].substr(4, 4); // SLICE MUX1 or MUX2  Start from 4 cuz " -> "
-        string device2_substr = devices[i + 1].substr(4, 4);
 
-        if (device1_substr == "MUX1"){
-            if (device1_substr == device2_substr){
-                string pin1 = device1.substr(9, 3); // SLICE pin number
-                string pin2 = device2.substr(9, 3);
-                // cout << "SetConection(1000, " << pin1 << ", " << pin2 << ")\n";
+    int pair = mainBreadboardPin * ROUTE_TABLE_MCU_PINS + mcuBreadboardPin;
+    uint16_t at = pgm_read_word(&routeTableOffsets[pair]);
+    uint16_t end = pgm_read_word(&routeTableOffsets[pair + 1]);
+
+    while (at < end)
+    {
+        uint8_t count = pgm_read_byte(&routeTableRoutes[at]);
+        bool free = true;
+        for (uint8_t i = 0; i < count; i++)
+        {
+            uint8_t packed = pgm_read_byte(&routeTableRoutes[at + 1 + i]);
+            route[i].chip = packed >> 7;
+            route[i].x = (packed >> 3) & 15;
+            route[i].y = packed & 7;
+            if (isRoutePinUsed(route[i].chip * 24 + route[i].x) || isRoutePinUsed(route[i].chip * 24 + 16 + route[i].y))
+            {
+                free = false;
+                break;
             }
         }
 
-        if (device1_substr == "MUX2"){
-            if (device1_substr == device2_substr){
-                string pin1 = device1.substr(9, 3);
-                string pin2 = device2.substr(9, 3);
-                // cout << "SetConection(1001, " << pin1 << ", " << pin2 << ")\n";
-            }
+        if (free)
+        {
+            reserveRoute(route, count);
+            return count;
         }
+        at += 1 + count;
     }
+    return 0;
 }
 
-struct PathRequest
-{
-    Device *startDevice;
-    char startType;
-    int startPin;
-    Device *endDevice;
-    char endType;
-    int endPin;
-
-    PathRequest(Device *startDevice, char startType, int startPin, Device *endDevice, char endType, int endPin)
-        : startDevice(startDevice), startType(startType), startPin(startPin), endDevice(endDevice), endType(endType), endPin(endPin) {}
-};
-
-int findAndPrintPath(Graph &graph, const PathRequest &request)
+// Prints a route returned by findRoute over Serial: its vertices from the MainBreadboard pin to the
+// MCUBreadboard pin, then the CH446Q switches it closes
+void printRoute(uint8_t mainBreadboardPin, uint8_t mcuBreadboardPin, const MuxSwitch *route, uint8_t switches)
 {
-    int startVertex = getGraphVertexID(request.startDevice, request.startType, request.startPin);
-    int endVertex = getGraphVertexID(request.endDevice, request.endType, request.endPin);
-
-    vector<int> path = graph.findPathBFS(startVertex, endVertex);
-    if (!path.empty())
+    char label[VERTEX_LABEL_SIZE];
+    formatVertexLabel(label, mainPin(mainBreadboardPin));
+    Serial.print(label);
+    for (uint8_t i = 0; i < switches; i++)
     {
-        string from = printDeviceSpecifications(startVertex);
-        string to = printDeviceSpecifications(endVertex);
-
-        // cout << "\nPath from " << from << " to " << to << " is: \n";
-        for (int vertex : path)
-        {
-            string device = printDeviceSpecifications(vertex);
-            // cout << device;
-        }
-
-        printMUXConections(path); // Print all MUX conections
-        // cout << "\n\n";
-        return 1;
+        formatVertexLabel(label, muxX(route[i].chip, route[i].x));
+        Serial.print(label);
+        formatVertexLabel(label, muxY(route[i].chip, route[i].y));
+        Serial.print(label);
     }
-    else
-    {
-        string from = printDeviceSpecifications(startVertex);
-        string to = printDeviceSpecifications(endVertex);
+    formatVertexLabel(label, mcuPin(mcuBreadboardPin));
+    Serial.println(label);
 
-        // cout << "\nNo path found from " << from << " to " << to << ".\n\n";
-        return 0;
+    // MUX1 -> 1000    MUX2 -> 1001
+    for (uint8_t i = 0; i < switches; i++)
+    {
+        Serial.print("SetConnection(");
+        Serial.print(route[i].chip == 0 ? "1000" : "1001");
+        Serial.print(", ");
+        Serial.print(route[i].x);
+        Serial.print(", ");
+        Serial.print(route[i].y);
+        Serial.println(")");
     }
 }
 
-
-int init_pathfinding() // initPathfinding
-{   
-    Serial.println("1");
-
-    Multiplexer mux1(0), mux2(1);
-    Breadboard main_breadboard(3), mcu_breadboard(4);
-
-    Multiplexer all_muxes[2] = {mux1, mux2};
-
-    int numVertices = 2 * 24 + 1 * 24 + 1 * 8;
-    Serial.println("before constructor");
-
-    Graph g(numVertices);
-    Serial.println("after constructor");
-
-    // Add edges to the graph every X to Y connection in the muxes
-    for (int i = 0; i < 2; i++)
+// Frees the MUX pins of a route returned by findRoute
+void releaseRoute(const MuxSwitch *route, uint8_t switches)
+{
+    for (uint8_t i = 0; i < switches; i++)
     {
-        for (int j = 0; j < 16; j++)
-        {
-            for (int k = 0; k < 8; k++)
-            {
-                // Serial.println("itteration");
-                int srcVertex = getGraphVertexID(&all_muxes[i], 'x', j);
-                int destVertex = getGraphVertexID(&all_muxes[i], 'y', k);
-                g.addEdge(srcVertex, destVertex);
-            }
-        }
+        setRoutePin(route[i].chip * 24 + route[i].x, false);
+        setRoutePin(route[i].chip * 24 + 16 + route[i].y, false);
     }
-    Serial.println("2");
-
-    // MUX1 pins edge connections FIXED
-    g.addEdge(getGraphVertexID(&mux1, 'x', 0), getGraphVertexID(&mux2, 'y', 0));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 1), getGraphVertexID(&mux2, 'y', 1));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 2), getGraphVertexID(&mux2, 'y', 2));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 3), getGraphVertexID(&mux2, 'y', 3));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 4), getGraphVertexID(&mux2, 'y', 4));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 5), getGraphVertexID(&mux2, 'y', 5));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 6), getGraphVertexID(&mux2, 'y', 6));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 7), getGraphVertexID(&mux2, 'y', 7));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 8), getGraphVertexID(&main_breadboard, 'p', 12));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 9), getGraphVertexID(&main_breadboard, 'p', 13));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 10), getGraphVertexID(&main_breadboard, 'p', 14));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 11), getGraphVertexID(&main_breadboard, 'p', 15));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 12), getGraphVertexID(&main_breadboard, 'p', 16));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 13), getGraphVertexID(&main_breadboard, 'p', 17));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 14), getGraphVertexID(&main_breadboard, 'p', 18));
-    g.addEdge(getGraphVertexID(&mux1, 'x', 15), getGraphVertexID(&main_breadboard, 'p', 19));
-
-    g.addEdge(getGraphVertexID(&mux1, 'y', 0), getGraphVertexID(&mcu_breadboard, 'p', 0));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 1), getGraphVertexID(&mcu_breadboard, 'p', 1));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 2), getGraphVertexID(&mcu_breadboard, 'p', 2));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 3), getGraphVertexID(&mcu_breadboard, 'p', 3));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 4), getGraphVertexID(&mcu_breadboard, 'p', 4));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 5), getGraphVertexID(&mcu_breadboard, 'p', 5));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 6), getGraphVertexID(&mcu_breadboard, 'p', 6));
-    g.addEdge(getGraphVertexID(&mux1, 'y', 7), getGraphVertexID(&mcu_breadboard, 'p', 7));
-
-    // MUX2 pins edge connections FIXED
-    g.addEdge(getGraphVertexID(&mux2, 'x', 0), getGraphVertexID(&main_breadboard, 'p', 20));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 1), getGraphVertexID(&main_breadboard, 'p', 21));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 2), getGraphVertexID(&main_breadboard, 'p', 22));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 3), getGraphVertexID(&main_breadboard, 'p', 23));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 4), getGraphVertexID(&main_breadboard, 'p', 0));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 5), getGraphVertexID(&main_breadboard, 'p', 1));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 6), getGraphVertexID(&main_breadboard, 'p', 2));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 7), getGraphVertexID(&main_breadboard, 'p', 3));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 8), getGraphVertexID(&main_breadboard, 'p', 4));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 9), getGraphVertexID(&main_breadboard, 'p', 5));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 10), getGraphVertexID(&main_breadboard, 'p', 6));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 11), getGraphVertexID(&main_breadboard, 'p', 7));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 12), getGraphVertexID(&main_breadboard, 'p', 8));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 13), getGraphVertexID(&main_breadboard, 'p', 9));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 14), getGraphVertexID(&main_breadboard, 'p', 10));
-    g.addEdge(getGraphVertexID(&mux2, 'x', 15), getGraphVertexID(&main_breadboard, 'p', 11));
-
-
-    vector<PathRequest> requests;
-    
-    int mcu_pin, main_pin;
-    // std::cout << "Enter MCU pin: ";
-    // std::cin >> mcu_pin;
-    // std::cout << "Enter MAIN breadboard pin: ";
-    // std::cin >> main_pin;
-
-    mcu_pin = 1;
-    main_pin = 1;
-    Serial.println("10");
-
-
-    PathRequest request(&main_breadboard, 'p', main_pin, &mcu_breadboard, 'p', mcu_pin);
-    int path_found = findAndPrintPath(g, request);
-
-    // std::cout << "Number of paths found: " << path_found << std::endl;
-
-    Serial.println("pathfinding init");
-
-    return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,231 @@
+// Generated by PathfindingMUX/mini_scheme/generate_route_table.cpp, do not edit by hand.
+// 1088 routes for 24 MainBreadboard x 8 MCUBreadboard pin pairs, 3200 bytes of routes.
+#pragma once
+
+#include <avr/pgmspace.h>
+
+#define ROUTE_TABLE_MAIN_PINS 24
+#define ROUTE_TABLE_MCU_PINS 8
+#define ROUTE_MAX_SWITCHES 2
+#define ROUTE_MAX_CANDIDATES 8
+
+// Routes of pair (main, mcu) are routeTableRoutes[routeTableOffsets[main * 8 + mcu] .. routeTableOffsets[main * 8 + mcu + 1]).
+// Every route is a switch count followed by that many switches packed as MUX(1) | X(4) | Y(3).
+const uint16_t routeTableOffsets[193] PROGMEM = {
+    0, 24, 48, 72, 96, 120, 144, 168, 192, 216, 240, 264, 288, 312, 336, 360,
+    384, 408, 432, 456, 480, 504, 528, 552, 576, 600, 624, 648, 672, 696, 720, 744,
+    768, 792, 816, 840, 864, 888, 912, 936, 960, 984, 1008, 1032, 1056, 1080, 1104, 1128,
+    1152, 1176, 1200, 1224, 1248, 1272, 1296, 1320, 1344, 1368, 1392, 1416, 1440, 1464, 1488, 1512,
+    1536, 1560, 1584, 1608, 1632, 1656, 1680, 1704, 1728, 1752, 1776, 1800, 1824, 1848, 1872, 1896,
+    1920, 1944, 1968, 1992, 2016, 2040, 2064, 2088, 2112, 2136, 2160, 2184, 2208, 2232, 2256, 2280,
+    2304, 2306, 2308, 2310, 2312, 2314, 2316, 2318, 2320, 2322, 2324, 2326, 2328, 2330, 2332, 2334,
+    2336, 2338, 2340, 2342, 2344, 2346, 2348, 2350, 2352, 2354, 2356, 2358, 2360, 2362, 2364, 2366,
+    2368, 2370, 2372, 2374, 2376, 2378, 2380, 2382, 2384, 2386, 2388, 2390, 2392, 2394, 2396, 2398,
+    2400, 2402, 2404, 2406, 2408, 2410, 2412, 2414, 2416, 2418, 2420, 2422, 2424, 2426, 2428, 2430,
+    2432, 2456, 2480, 2504, 2528, 2552, 2576, 2600, 2624, 2648, 2672, 2696, 2720, 2744, 2768, 2792,
+    2816, 2840, 2864, 2888, 2912, 2936, 2960, 2984, 3008, 3032, 3056, 3080, 3104, 3128, 3152, 3176,
+    3200
+};
+
+const uint8_t routeTableRoutes[3200] PROGMEM = {
+    0x02, 0xA0, 0x00, 0x02, 0xA1, 0x08, 0x02, 0xA2, 0x10, 0x02, 0xA3, 0x18, 0x02, 0xA4, 0x20, 0x02,
+    0xA5, 0x28, 0x02, 0xA6, 0x30, 0x02, 0xA7, 0x38, 0x02, 0xA0, 0x01, 0x02, 0xA1, 0x09, 0x02, 0xA2,
+    0x11, 0x02, 0xA3, 0x19, 0x02, 0xA4, 0x21, 0x02, 0xA5, 0x29, 0x02, 0xA6, 0x31, 0x02, 0xA7, 0x39,
+    0x02, 0xA0, 0x02, 0x02, 0xA1, 0x0A, 0x02, 0xA2, 0x12, 0x02, 0xA3, 0x1A, 0x02, 0xA4, 0x22, 0x02,
+    0xA5, 0x2A, 0x02, 0xA6, 0x32, 0x02, 0xA7, 0x3A, 0x02, 0xA0, 0x03, 0x02, 0xA1, 0x0B, 0x02, 0xA2,
+    0x13, 0x02, 0xA3, 0x1B, 0x02, 0xA4, 0x23, 0x02, 0xA5, 0x2B, 0x02, 0xA6, 0x33, 0x02, 0xA7, 0x3B,
+    0x02, 0xA0, 0x04, 0x02, 0xA1, 0x0C, 0x02, 0xA2, 0x14, 0x02, 0xA3, 0x1C, 0x02, 0xA4, 0x24, 0x02,
+    0xA5, 0x2C, 0x02, 0xA6, 0x34, 0x02, 0xA7, 0x3C, 0x02, 0xA0, 0x05, 0x02, 0xA1, 0x0D, 0x02, 0xA2,
+    0x15, 0x02, 0xA3, 0x1D, 0x02, 0xA4, 0x25, 0x02, 0xA5, 0x2D, 0x02, 0xA6, 0x35, 0x02, 0xA7, 0x3D,
+    0x02, 0xA0, 0x06, 0x02, 0xA1, 0x0E, 0x02, 0xA2, 0x16, 0x02, 0xA3, 0x1E, 0x02, 0xA4, 0x26, 0x02,
+    0xA5, 0x2E, 0x02, 0xA6, 0x36, 0x02, 0xA7, 0x3E, 0x02, 0xA0, 0x07, 0x02, 0xA1, 0x0F, 0x02, 0xA2,
+    0x17, 0x02, 0xA3, 0x1F, 0x02, 0xA4, 0x27, 0x02, 0xA5, 0x2F, 0x02, 0xA6, 0x37, 0x02, 0xA7, 0x3F,
+    0x02, 0xA8, 0x00, 0x02, 0xA9, 0x08, 0x02, 0xAA, 0x10, 0x02, 0xAB, 0x18, 0x02, 0xAC, 0x20, 0x02,
+    0xAD, 0x28, 0x02, 0xAE, 0x30, 0x02, 0xAF, 0x38, 0x02, 0xA8, 0x01, 0x02, 0xA9, 0x09, 0x02, 0xAA,
+    0x11, 0x02, 0xAB, 0x19, 0x02, 0xAC, 0x21, 0x02, 0xAD, 0x29, 0x02, 0xAE, 0x31, 0x02, 0xAF, 0x39,
+    0x02, 0xA8, 0x02, 0x02, 0xA9, 0x0A, 0x02, 0xAA, 0x12, 0x02, 0xAB, 0x1A, 0x02, 0xAC, 0x22, 0x02,
+    0xAD, 0x2A, 0x02, 0xAE, 0x32, 0x02, 0xAF, 0x3A, 0x02, 0xA8, 0x03, 0x02, 0xA9, 0x0B, 0x02, 0xAA,
+    0x13, 0x02, 0xAB, 0x1B, 0x02, 0xAC, 0x23, 0x02, 0xAD, 0x2B, 0x02, 0xAE, 0x33, 0x02, 0xAF, 0x3B,
+    0x02, 0xA8, 0x04, 0x02, 0xA9, 0x0C, 0x02, 0xAA, 0x14, 0x02, 0xAB, 0x1C, 0x02, 0xAC, 0x24, 0x02,
+    0xAD, 0x2C, 0x02, 0xAE, 0x34, 0x02, 0xAF, 0x3C, 0x02, 0xA8, 0x05, 0x02, 0xA9, 0x0D, 0x02, 0xAA,
+    0x15, 0x02, 0xAB, 0x1D, 0x02, 0xAC, 0x25, 0x02, 0xAD, 0x2D, 0x02, 0xAE, 0x35, 0x02, 0xAF, 0x3D,
+    0x02, 0xA8, 0x06, 0x02, 0xA9, 0x0E, 0x02, 0xAA, 0x16, 0x02, 0xAB, 0x1E, 0x02, 0xAC, 0x26, 0x02,
+    0xAD, 0x2E, 0x02, 0xAE, 0x36, 0x02, 0xAF, 0x3E, 0x02, 0xA8, 0x07, 0x02, 0xA9, 0x0F, 0x02, 0xAA,
+    0x17, 0x02, 0xAB, 0x1F, 0x02, 0xAC, 0x27, 0x02, 0xAD, 0x2F, 0x02, 0xAE, 0x37, 0x02, 0xAF, 0x3F,
+    0x02, 0xB0, 0x00, 0x02, 0xB1, 0x08, 0x02, 0xB2, 0x10, 0x02, 0xB3, 0x18, 0x02, 0xB4, 0x20, 0x02,
+    0xB5, 0x28, 0x02, 0xB6, 0x30, 0x02, 0xB7, 0x38, 0x02, 0xB0, 0x01, 0x02, 0xB1, 0x09, 0x02, 0xB2,
+    0x11, 0x02, 0xB3, 0x19, 0x02, 0xB4, 0x21, 0x02, 0xB5, 0x29, 0x02, 0xB6, 0x31, 0x02, 0xB7, 0x39,
+    0x02, 0xB0, 0x02, 0x02, 0xB1, 0x0A, 0x02, 0xB2, 0x12, 0x02, 0xB3, 0x1A, 0x02, 0xB4, 0x22, 0x02,
+    0xB5, 0x2A, 0x02, 0xB6, 0x32, 0x02, 0xB7, 0x3A, 0x02, 0xB0, 0x03, 0x02, 0xB1, 0x0B, 0x02, 0xB2,
+    0x13, 0x02, 0xB3, 0x1B, 0x02, 0xB4, 0x23, 0x02, 0xB5, 0x2B, 0x02, 0xB6, 0x33, 0x02, 0xB7, 0x3B,
+    0x02, 0xB0, 0x04, 0x02, 0xB1, 0x0C, 0x02, 0xB2, 0x14, 0x02, 0xB3, 0x1C, 0x02, 0xB4, 0x24, 0x02,
+    0xB5, 0x2C, 0x02, 0xB6, 0x34, 0x02, 0xB7, 0x3C, 0x02, 0xB0, 0x05, 0x02, 0xB1, 0x0D, 0x02, 0xB2,
+    0x15, 0x02, 0xB3, 0x1D, 0x02, 0xB4, 0x25, 0x02, 0xB5, 0x2D, 0x02, 0xB6, 0x35, 0x02, 0xB7, 0x3D,
+    0x02, 0xB0, 0x06, 0x02, 0xB1, 0x0E, 0x02, 0xB2, 0x16, 0x02, 0xB3, 0x1E, 0x02, 0xB4, 0x26, 0x02,
+    0xB5, 0x2E, 0x02, 0xB6, 0x36, 0x02, 0xB7, 0x3E, 0x02, 0xB0, 0x07, 0x02, 0xB1, 0x0F, 0x02, 0xB2,
+    0x17, 0x02, 0xB3, 0x1F, 0x02, 0xB4, 0x27, 0x02, 0xB5, 0x2F, 0x02, 0xB6, 0x37, 0x02, 0xB7, 0x3F,
+    0x02, 0xB8, 0x00, 0x02, 0xB9, 0x08, 0x02, 0xBA, 0x10, 0x02, 0xBB, 0x18, 0x02, 0xBC, 0x20, 0x02,
+    0xBD, 0x28, 0x02, 0xBE, 0x30, 0x02, 0xBF, 0x38, 0x02, 0xB8, 0x01, 0x02, 0xB9, 0x09, 0x02, 0xBA,
+    0x11, 0x02, 0xBB, 0x19, 0x02, 0xBC, 0x21, 0x02, 0xBD, 0x29, 0x02, 0xBE, 0x31, 0x02, 0xBF, 0x39,
+    0x02, 0xB8, 0x02, 0x02, 0xB9, 0x0A, 0x02, 0xBA, 0x12, 0x02, 0xBB, 0x1A, 0x02, 0xBC, 0x22, 0x02,
+    0xBD, 0x2A, 0x02, 0xBE, 0x32, 0x02, 0xBF, 0x3A, 0x02, 0xB8, 0x03, 0x02, 0xB9, 0x0B, 0x02, 0xBA,
+    0x13, 0x02, 0xBB, 0x1B, 0x02, 0xBC, 0x23, 0x02, 0xBD, 0x2B, 0x02, 0xBE, 0x33, 0x02, 0xBF, 0x3B,
+    0x02, 0xB8, 0x04, 0x02, 0xB9, 0x0C, 0x02, 0xBA, 0x14, 0x02, 0xBB, 0x1C, 0x02, 0xBC, 0x24, 0x02,
+    0xBD, 0x2C, 0x02, 0xBE, 0x34, 0x02, 0xBF, 0x3C, 0x02, 0xB8, 0x05, 0x02, 0xB9, 0x0D, 0x02, 0xBA,
+    0x15, 0x02, 0xBB, 0x1D, 0x02, 0xBC, 0x25, 0x02, 0xBD, 0x2D, 0x02, 0xBE, 0x35, 0x02, 0xBF, 0x3D,
+    0x02, 0xB8, 0x06, 0x02, 0xB9, 0x0E, 0x02, 0xBA, 0x16, 0x02, 0xBB, 0x1E, 0x02, 0xBC, 0x26, 0x02,
+    0xBD, 0x2E, 0x02, 0xBE, 0x36, 0x02, 0xBF, 0x3E, 0x02, 0xB8, 0x07, 0x02, 0xB9, 0x0F, 0x02, 0xBA,
+    0x17, 0x02, 0xBB, 0x1F, 0x02, 0xBC, 0x27, 0x02, 0xBD, 0x2F, 0x02, 0xBE, 0x37, 0x02, 0xBF, 0x3F,
+    0x02, 0xC0, 0x00, 0x02, 0xC1, 0x08, 0x02, 0xC2, 0x10, 0x02, 0xC3, 0x18, 0x02, 0xC4, 0x20, 0x02,
+    0xC5, 0x28, 0x02, 0xC6, 0x30, 0x02, 0xC7, 0x38, 0x02, 0xC0, 0x01, 0x02, 0xC1, 0x09, 0x02, 0xC2,
+    0x11, 0x02, 0xC3, 0x19, 0x02, 0xC4, 0x21, 0x02, 0xC5, 0x29, 0x02, 0xC6, 0x31, 0x02, 0xC7, 0x39,
+    0x02, 0xC0, 0x02, 0x02, 0xC1, 0x0A, 0x02, 0xC2, 0x12, 0x02, 0xC3, 0x1A, 0x02, 0xC4, 0x22, 0x02,
+    0xC5, 0x2A, 0x02, 0xC6, 0x32, 0x02, 0xC7, 0x3A, 0x02, 0xC0, 0x03, 0x02, 0xC1, 0x0B, 0x02, 0xC2,
+    0x13, 0x02, 0xC3, 0x1B, 0x02, 0xC4, 0x23, 0x02, 0xC5, 0x2B, 0x02, 0xC6, 0x33, 0x02, 0xC7, 0x3B,
+    0x02, 0xC0, 0x04, 0x02, 0xC1, 0x0C, 0x02, 0xC2, 0x14, 0x02, 0xC3, 0x1C, 0x02, 0xC4, 0x24, 0x02,
+    0xC5, 0x2C, 0x02, 0xC6, 0x34, 0x02, 0xC7, 0x3C, 0x02, 0xC0, 0x05, 0x02, 0xC1, 0x0D, 0x02, 0xC2,
+    0x15, 0x02, 0xC3, 0x1D, 0x02, 0xC4, 0x25, 0x02, 0xC5, 0x2D, 0x02, 0xC6, 0x35, 0x02, 0xC7, 0x3D,
+    0x02, 0xC0, 0x06, 0x02, 0xC1, 0x0E, 0x02, 0xC2, 0x16, 0x02, 0xC3, 0x1E, 0x02, 0xC4, 0x26, 0x02,
+    0xC5, 0x2E, 0x02, 0xC6, 0x36, 0x02, 0xC7, 0x3E, 0x02, 0xC0, 0x07, 0x02, 0xC1, 0x0F, 0x02, 0xC2,
+    0x17, 0x02, 0xC3, 0x1F, 0x02, 0xC4, 0x27, 0x02, 0xC5, 0x2F, 0x02, 0xC6, 0x37, 0x02, 0xC7, 0x3F,
+    0x02, 0xC8, 0x00, 0x02, 0xC9, 0x08, 0x02, 0xCA, 0x10, 0x02, 0xCB, 0x18, 0x02, 0xCC, 0x20, 0x02,
+    0xCD, 0x28, 0x02, 0xCE, 0x30, 0x02, 0xCF, 0x38, 0x02, 0xC8, 0x01, 0x02, 0xC9, 0x09, 0x02, 0xCA,
+    0x11, 0x02, 0xCB, 0x19, 0x02, 0xCC, 0x21, 0x02, 0xCD, 0x29, 0x02, 0xCE, 0x31, 0x02, 0xCF, 0x39,
+    0x02, 0xC8, 0x02, 0x02, 0xC9, 0x0A, 0x02, 0xCA, 0x12, 0x02, 0xCB, 0x1A, 0x02, 0xCC, 0x22, 0x02,
+    0xCD, 0x2A, 0x02, 0xCE, 0x32, 0x02, 0xCF, 0x3A, 0x02, 0xC8, 0x03, 0x02, 0xC9, 0x0B, 0x02, 0xCA,
+    0x13, 0x02, 0xCB, 0x1B, 0x02, 0xCC, 0x23, 0x02, 0xCD, 0x2B, 0x02, 0xCE, 0x33, 0x02, 0xCF, 0x3B,
+    0x02, 0xC8, 0x04, 0x02, 0xC9, 0x0C, 0x02, 0xCA, 0x14, 0x02, 0xCB, 0x1C, 0x02, 0xCC, 0x24, 0x02,
+    0xCD, 0x2C, 0x02, 0xCE, 0x34, 0x02, 0xCF, 0x3C, 0x02, 0xC8, 0x05, 0x02, 0xC9, 0x0D, 0x02, 0xCA,
+    0x15, 0x02, 0xCB, 0x1D, 0x02, 0xCC, 0x25, 0x02, 0xCD, 0x2D, 0x02, 0xCE, 0x35, 0x02, 0xCF, 0x3D,
+    0x02, 0xC8, 0x06, 0x02, 0xC9, 0x0E, 0x02, 0xCA, 0x16, 0x02, 0xCB, 0x1E, 0x02, 0xCC, 0x26, 0x02,
+    0xCD, 0x2E, 0x02, 0xCE, 0x36, 0x02, 0xCF, 0x3E, 0x02, 0xC8, 0x07, 0x02, 0xC9, 0x0F, 0x02, 0xCA,
+    0x17, 0x02, 0xCB, 0x1F, 0x02, 0xCC, 0x27, 0x02, 0xCD, 0x2F, 0x02, 0xCE, 0x37, 0x02, 0xCF, 0x3F,
+    0x02, 0xD0, 0x00, 0x02, 0xD1, 0x08, 0x02, 0xD2, 0x10, 0x02, 0xD3, 0x18, 0x02, 0xD4, 0x20, 0x02,
+    0xD5, 0x28, 0x02, 0xD6, 0x30, 0x02, 0xD7, 0x38, 0x02, 0xD0, 0x01, 0x02, 0xD1, 0x09, 0x02, 0xD2,
+    0x11, 0x02, 0xD3, 0x19, 0x02, 0xD4, 0x21, 0x02, 0xD5, 0x29, 0x02, 0xD6, 0x31, 0x02, 0xD7, 0x39,
+    0x02, 0xD0, 0x02, 0x02, 0xD1, 0x0A, 0x02, 0xD2, 0x12, 0x02, 0xD3, 0x1A, 0x02, 0xD4, 0x22, 0x02,
+    0xD5, 0x2A, 0x02, 0xD6, 0x32, 0x02, 0xD7, 0x3A, 0x02, 0xD0, 0x03, 0x02, 0xD1, 0x0B, 0x02, 0xD2,
+    0x13, 0x02, 0xD3, 0x1B, 0x02, 0xD4, 0x23, 0x02, 0xD5, 0x2B, 0x02, 0xD6, 0x33, 0x02, 0xD7, 0x3B,
+    0x02, 0xD0, 0x04, 0x02, 0xD1, 0x0C, 0x02, 0xD2, 0x14, 0x02, 0xD3, 0x1C, 0x02, 0xD4, 0x24, 0x02,
+    0xD5, 0x2C, 0x02, 0xD6, 0x34, 0x02, 0xD7, 0x3C, 0x02, 0xD0, 0x05, 0x02, 0xD1, 0x0D, 0x02, 0xD2,
+    0x15, 0x02, 0xD3, 0x1D, 0x02, 0xD4, 0x25, 0x02, 0xD5, 0x2D, 0x02, 0xD6, 0x35, 0x02, 0xD7, 0x3D,
+    0x02, 0xD0, 0x06, 0x02, 0xD1, 0x0E, 0x02, 0xD2, 0x16, 0x02, 0xD3, 0x1E, 0x02, 0xD4, 0x26, 0x02,
+    0xD5, 0x2E, 0x02, 0xD6, 0x36, 0x02, 0xD7, 0x3E, 0x02, 0xD0, 0x07, 0x02, 0xD1, 0x0F, 0x02, 0xD2,
+    0x17, 0x02, 0xD3, 0x1F, 0x02, 0xD4, 0x27, 0x02, 0xD5, 0x2F, 0x02, 0xD6, 0x37, 0x02, 0xD7, 0x3F,
+    0x02, 0xD8, 0x00, 0x02, 0xD9, 0x08, 0x02, 0xDA, 0x10, 0x02, 0xDB, 0x18, 0x02, 0xDC, 0x20, 0x02,
+    0xDD, 0x28, 0x02, 0xDE, 0x30, 0x02, 0xDF, 0x38, 0x02, 0xD8, 0x01, 0x02, 0xD9, 0x09, 0x02, 0xDA,
+    0x11, 0x02, 0xDB, 0x19, 0x02, 0xDC, 0x21, 0x02, 0xDD, 0x29, 0x02, 0xDE, 0x31, 0x02, 0xDF, 0x39,
+    0x02, 0xD8, 0x02, 0x02, 0xD9, 0x0A, 0x02, 0xDA, 0x12, 0x02, 0xDB, 0x1A, 0x02, 0xDC, 0x22, 0x02,
+    0xDD, 0x2A, 0x02, 0xDE, 0x32, 0x02, 0xDF, 0x3A, 0x02, 0xD8, 0x03, 0x02, 0xD9, 0x0B, 0x02, 0xDA,
+    0x13, 0x02, 0xDB, 0x1B, 0x02, 0xDC, 0x23, 0x02, 0xDD, 0x2B, 0x02, 0xDE, 0x33, 0x02, 0xDF, 0x3B,
+    0x02, 0xD8, 0x04, 0x02, 0xD9, 0x0C, 0x02, 0xDA, 0x14, 0x02, 0xDB, 0x1C, 0x02, 0xDC, 0x24, 0x02,
+    0xDD, 0x2C, 0x02, 0xDE, 0x34, 0x02, 0xDF, 0x3C, 0x02, 0xD8, 0x05, 0x02, 0xD9, 0x0D, 0x02, 0xDA,
+    0x15, 0x02, 0xDB, 0x1D, 0x02, 0xDC, 0x25, 0x02, 0xDD, 0x2D, 0x02, 0xDE, 0x35, 0x02, 0xDF, 0x3D,
+    0x02, 0xD8, 0x06, 0x02, 0xD9, 0x0E, 0x02, 0xDA, 0x16, 0x02, 0xDB, 0x1E, 0x02, 0xDC, 0x26, 0x02,
+    0xDD, 0x2E, 0x02, 0xDE, 0x36, 0x02, 0xDF, 0x3E, 0x02, 0xD8, 0x07, 0x02, 0xD9, 0x0F, 0x02, 0xDA,
+    0x17, 0x02, 0xDB, 0x1F, 0x02, 0xDC, 0x27, 0x02, 0xDD, 0x2F, 0x02, 0xDE, 0x37, 0x02, 0xDF, 0x3F,
+    0x02, 0xE0, 0x00, 0x02, 0xE1, 0x08, 0x02, 0xE2, 0x10, 0x02, 0xE3, 0x18, 0x02, 0xE4, 0x20, 0x02,
+    0xE5, 0x28, 0x02, 0xE6, 0x30, 0x02, 0xE7, 0x38, 0x02, 0xE0, 0x01, 0x02, 0xE1, 0x09, 0x02, 0xE2,
+    0x11, 0x02, 0xE3, 0x19, 0x02, 0xE4, 0x21, 0x02, 0xE5, 0x29, 0x02, 0xE6, 0x31, 0x02, 0xE7, 0x39,
+    0x02, 0xE0, 0x02, 0x02, 0xE1, 0x0A, 0x02, 0xE2, 0x12, 0x02, 0xE3, 0x1A, 0x02, 0xE4, 0x22, 0x02,
+    0xE5, 0x2A, 0x02, 0xE6, 0x32, 0x02, 0xE7, 0x3A, 0x02, 0xE0, 0x03, 0x02, 0xE1, 0x0B, 0x02, 0xE2,
+    0x13, 0x02, 0xE3, 0x1B, 0x02, 0xE4, 0x23, 0x02, 0xE5, 0x2B, 0x02, 0xE6, 0x33, 0x02, 0xE7, 0x3B,
+    0x02, 0xE0, 0x04, 0x02, 0xE1, 0x0C, 0x02, 0xE2, 0x14, 0x02, 0xE3, 0x1C, 0x02, 0xE4, 0x24, 0x02,
+    0xE5, 0x2C, 0x02, 0xE6, 0x34, 0x02, 0xE7, 0x3C, 0x02, 0xE0, 0x05, 0x02, 0xE1, 0x0D, 0x02, 0xE2,
+    0x15, 0x02, 0xE3, 0x1D, 0x02, 0xE4, 0x25, 0x02, 0xE5, 0x2D, 0x02, 0xE6, 0x35, 0x02, 0xE7, 0x3D,
+    0x02, 0xE0, 0x06, 0x02, 0xE1, 0x0E, 0x02, 0xE2, 0x16, 0x02, 0xE3, 0x1E, 0x02, 0xE4, 0x26, 0x02,
+    0xE5, 0x2E, 0x02, 0xE6, 0x36, 0x02, 0xE7, 0x3E, 0x02, 0xE0, 0x07, 0x02, 0xE1, 0x0F, 0x02, 0xE2,
+    0x17, 0x02, 0xE3, 0x1F, 0x02, 0xE4, 0x27, 0x02, 0xE5, 0x2F, 0x02, 0xE6, 0x37, 0x02, 0xE7, 0x3F,
+    0x02, 0xE8, 0x00, 0x02, 0xE9, 0x08, 0x02, 0xEA, 0x10, 0x02, 0xEB, 0x18, 0x02, 0xEC, 0x20, 0x02,
+    0xED, 0x28, 0x02, 0xEE, 0x30, 0x02, 0xEF, 0x38, 0x02, 0xE8, 0x01, 0x02, 0xE9, 0x09, 0x02, 0xEA,
+    0x11, 0x02, 0xEB, 0x19, 0x02, 0xEC, 0x21, 0x02, 0xED, 0x29, 0x02, 0xEE, 0x31, 0x02, 0xEF, 0x39,
+    0x02, 0xE8, 0x02, 0x02, 0xE9, 0x0A, 0x02, 0xEA, 0x12, 0x02, 0xEB, 0x1A, 0x02, 0xEC, 0x22, 0x02,
+    0xED, 0x2A, 0x02, 0xEE, 0x32, 0x02, 0xEF, 0x3A, 0x02, 0xE8, 0x03, 0x02, 0xE9, 0x0B, 0x02, 0xEA,
+    0x13, 0x02, 0xEB, 0x1B, 0x02, 0xEC, 0x23, 0x02, 0xED, 0x2B, 0x02, 0xEE, 0x33, 0x02, 0xEF, 0x3B,
+    0x02, 0xE8, 0x04, 0x02, 0xE9, 0x0C, 0x02, 0xEA, 0x14, 0x02, 0xEB, 0x1C, 0x02, 0xEC, 0x24, 0x02,
+    0xED, 0x2C, 0x02, 0xEE, 0x34, 0x02, 0xEF, 0x3C, 0x02, 0xE8, 0x05, 0x02, 0xE9, 0x0D, 0x02, 0xEA,
+    0x15, 0x02, 0xEB, 0x1D, 0x02, 0xEC, 0x25, 0x02, 0xED, 0x2D, 0x02, 0xEE, 0x35, 0x02, 0xEF, 0x3D,
+    0x02, 0xE8, 0x06, 0x02, 0xE9, 0x0E, 0x02, 0xEA, 0x16, 0x02, 0xEB, 0x1E, 0x02, 0xEC, 0x26, 0x02,
+    0xED, 0x2E, 0x02, 0xEE, 0x36, 0x02, 0xEF, 0x3E, 0x02, 0xE8, 0x07, 0x02, 0xE9, 0x0F, 0x02, 0xEA,
+    0x17, 0x02, 0xEB, 0x1F, 0x02, 0xEC, 0x27, 0x02, 0xED, 0x2F, 0x02, 0xEE, 0x37, 0x02, 0xEF, 0x3F,
+    0x02, 0xF0, 0x00, 0x02, 0xF1, 0x08, 0x02, 0xF2, 0x10, 0x02, 0xF3, 0x18, 0x02, 0xF4, 0x20, 0x02,
+    0xF5, 0x28, 0x02, 0xF6, 0x30, 0x02, 0xF7, 0x38, 0x02, 0xF0, 0x01, 0x02, 0xF1, 0x09, 0x02, 0xF2,
+    0x11, 0x02, 0xF3, 0x19, 0x02, 0xF4, 0x21, 0x02, 0xF5, 0x29, 0x02, 0xF6, 0x31, 0x02, 0xF7, 0x39,
+    0x02, 0xF0, 0x02, 0x02, 0xF1, 0x0A, 0x02, 0xF2, 0x12, 0x02, 0xF3, 0x1A, 0x02, 0xF4, 0x22, 0x02,
+    0xF5, 0x2A, 0x02, 0xF6, 0x32, 0x02, 0xF7, 0x3A, 0x02, 0xF0, 0x03, 0x02, 0xF1, 0x0B, 0x02, 0xF2,
+    0x13, 0x02, 0xF3, 0x1B, 0x02, 0xF4, 0x23, 0x02, 0xF5, 0x2B, 0x02, 0xF6, 0x33, 0x02, 0xF7, 0x3B,
+    0x02, 0xF0, 0x04, 0x02, 0xF1, 0x0C, 0x02, 0xF2, 0x14, 0x02, 0xF3, 0x1C, 0x02, 0xF4, 0x24, 0x02,
+    0xF5, 0x2C, 0x02, 0xF6, 0x34, 0x02, 0xF7, 0x3C, 0x02, 0xF0, 0x05, 0x02, 0xF1, 0x0D, 0x02, 0xF2,
+    0x15, 0x02, 0xF3, 0x1D, 0x02, 0xF4, 0x25, 0x02, 0xF5, 0x2D, 0x02, 0xF6, 0x35, 0x02, 0xF7, 0x3D,
+    0x02, 0xF0, 0x06, 0x02, 0xF1, 0x0E, 0x02, 0xF2, 0x16, 0x02, 0xF3, 0x1E, 0x02, 0xF4, 0x26, 0x02,
+    0xF5, 0x2E, 0x02, 0xF6, 0x36, 0x02, 0xF7, 0x3E, 0x02, 0xF0, 0x07, 0x02, 0xF1, 0x0F, 0x02, 0xF2,
+    0x17, 0x02, 0xF3, 0x1F, 0x02, 0xF4, 0x27, 0x02, 0xF5, 0x2F, 0x02, 0xF6, 0x37, 0x02, 0xF7, 0x3F,
+    0x02, 0xF8, 0x00, 0x02, 0xF9, 0x08, 0x02, 0xFA, 0x10, 0x02, 0xFB, 0x18, 0x02, 0xFC, 0x20, 0x02,
+    0xFD, 0x28, 0x02, 0xFE, 0x30, 0x02, 0xFF, 0x38, 0x02, 0xF8, 0x01, 0x02, 0xF9, 0x09, 0x02, 0xFA,
+    0x11, 0x02, 0xFB, 0x19, 0x02, 0xFC, 0x21, 0x02, 0xFD, 0x29, 0x02, 0xFE, 0x31, 0x02, 0xFF, 0x39,
+    0x02, 0xF8, 0x02, 0x02, 0xF9, 0x0A, 0x02, 0xFA, 0x12, 0x02, 0xFB, 0x1A, 0x02, 0xFC, 0x22, 0x02,
+    0xFD, 0x2A, 0x02, 0xFE, 0x32, 0x02, 0xFF, 0x3A, 0x02, 0xF8, 0x03, 0x02, 0xF9, 0x0B, 0x02, 0xFA,
+    0x13, 0x02, 0xFB, 0x1B, 0x02, 0xFC, 0x23, 0x02, 0xFD, 0x2B, 0x02, 0xFE, 0x33, 0x02, 0xFF, 0x3B,
+    0x02, 0xF8, 0x04, 0x02, 0xF9, 0x0C, 0x02, 0xFA, 0x14, 0x02, 0xFB, 0x1C, 0x02, 0xFC, 0x24, 0x02,
+    0xFD, 0x2C, 0x02, 0xFE, 0x34, 0x02, 0xFF, 0x3C, 0x02, 0xF8, 0x05, 0x02, 0xF9, 0x0D, 0x02, 0xFA,
+    0x15, 0x02, 0xFB, 0x1D, 0x02, 0xFC, 0x25, 0x02, 0xFD, 0x2D, 0x02, 0xFE, 0x35, 0x02, 0xFF, 0x3D,
+    0x02, 0xF8, 0x06, 0x02, 0xF9, 0x0E, 0x02, 0xFA, 0x16, 0x02, 0xFB, 0x1E, 0x02, 0xFC, 0x26, 0x02,
+    0xFD, 0x2E, 0x02, 0xFE, 0x36, 0x02, 0xFF, 0x3E, 0x02, 0xF8, 0x07, 0x02, 0xF9, 0x0F, 0x02, 0xFA,
+    0x17, 0x02, 0xFB, 0x1F, 0x02, 0xFC, 0x27, 0x02, 0xFD, 0x2F, 0x02, 0xFE, 0x37, 0x02, 0xFF, 0x3F,
+    0x01, 0x40, 0x01, 0x41, 0x01, 0x42, 0x01, 0x43, 0x01, 0x44, 0x01, 0x45, 0x01, 0x46, 0x01, 0x47,
+    0x01, 0x48, 0x01, 0x49, 0x01, 0x4A, 0x01, 0x4B, 0x01, 0x4C, 0x01, 0x4D, 0x01, 0x4E, 0x01, 0x4F,
+    0x01, 0x50, 0x01, 0x51, 0x01, 0x52, 0x01, 0x53, 0x01, 0x54, 0x01, 0x55, 0x01, 0x56, 0x01, 0x57,
+    0x01, 0x58, 0x01, 0x59, 0x01, 0x5A, 0x01, 0x5B, 0x01, 0x5C, 0x01, 0x5D, 0x01, 0x5E, 0x01, 0x5F,
+    0x01, 0x60, 0x01, 0x61, 0x01, 0x62, 0x01, 0x63, 0x01, 0x64, 0x01, 0x65, 0x01, 0x66, 0x01, 0x67,
+    0x01, 0x68, 0x01, 0x69, 0x01, 0x6A, 0x01, 0x6B, 0x01, 0x6C, 0x01, 0x6D, 0x01, 0x6E, 0x01, 0x6F,
+    0x01, 0x70, 0x01, 0x71, 0x01, 0x72, 0x01, 0x73, 0x01, 0x74, 0x01, 0x75, 0x01, 0x76, 0x01, 0x77,
+    0x01, 0x78, 0x01, 0x79, 0x01, 0x7A, 0x01, 0x7B, 0x01, 0x7C, 0x01, 0x7D, 0x01, 0x7E, 0x01, 0x7F,
+    0x02, 0x80, 0x00, 0x02, 0x81, 0x08, 0x02, 0x82, 0x10, 0x02, 0x83, 0x18, 0x02, 0x84, 0x20, 0x02,
+    0x85, 0x28, 0x02, 0x86, 0x30, 0x02, 0x87, 0x38, 0x02, 0x80, 0x01, 0x02, 0x81, 0x09, 0x02, 0x82,
+    0x11, 0x02, 0x83, 0x19, 0x02, 0x84, 0x21, 0x02, 0x85, 0x29, 0x02, 0x86, 0x31, 0x02, 0x87, 0x39,
+    0x02, 0x80, 0x02, 0x02, 0x81, 0x0A, 0x02, 0x82, 0x12, 0x02, 0x83, 0x1A, 0x02, 0x84, 0x22, 0x02,
+    0x85, 0x2A, 0x02, 0x86, 0x32, 0x02, 0x87, 0x3A, 0x02, 0x80, 0x03, 0x02, 0x81, 0x0B, 0x02, 0x82,
+    0x13, 0x02, 0x83, 0x1B, 0x02, 0x84, 0x23, 0x02, 0x85, 0x2B, 0x02, 0x86, 0x33, 0x02, 0x87, 0x3B,
+    0x02, 0x80, 0x04, 0x02, 0x81, 0x0C, 0x02, 0x82, 0x14, 0x02, 0x83, 0x1C, 0x02, 0x84, 0x24, 0x02,
+    0x85, 0x2C, 0x02, 0x86, 0x34, 0x02, 0x87, 0x3C, 0x02, 0x80, 0x05, 0x02, 0x81, 0x0D, 0x02, 0x82,
+    0x15, 0x02, 0x83, 0x1D, 0x02, 0x84, 0x25, 0x02, 0x85, 0x2D, 0x02, 0x86, 0x35, 0x02, 0x87, 0x3D,
+    0x02, 0x80, 0x06, 0x02, 0x81, 0x0E, 0x02, 0x82, 0x16, 0x02, 0x83, 0x1E, 0x02, 0x84, 0x26, 0x02,
+    0x85, 0x2E, 0x02, 0x86, 0x36, 0x02, 0x87, 0x3E, 0x02, 0x80, 0x07, 0x02, 0x81, 0x0F, 0x02, 0x82,
+    0x17, 0x02, 0x83, 0x1F, 0x02, 0x84, 0x27, 0x02, 0x85, 0x2F, 0x02, 0x86, 0x37, 0x02, 0x87, 0x3F,
+    0x02, 0x88, 0x00, 0x02, 0x89, 0x08, 0x02, 0x8A, 0x10, 0x02, 0x8B, 0x18, 0x02, 0x8C, 0x20, 0x02,
+    0x8D, 0x28, 0x02, 0x8E, 0x30, 0x02, 0x8F, 0x38, 0x02, 0x88, 0x01, 0x02, 0x89, 0x09, 0x02, 0x8A,
+    0x11, 0x02, 0x8B, 0x19, 0x02, 0x8C, 0x21, 0x02, 0x8D, 0x29, 0x02, 0x8E, 0x31, 0x02, 0x8F, 0x39,
+    0x02, 0x88, 0x02, 0x02, 0x89, 0x0A, 0x02, 0x8A, 0x12, 0x02, 0x8B, 0x1A, 0x02, 0x8C, 0x22, 0x02,
+    0x8D, 0x2A, 0x02, 0x8E, 0x32, 0x02, 0x8F, 0x3A, 0x02, 0x88, 0x03, 0x02, 0x89, 0x0B, 0x02, 0x8A,
+    0x13, 0x02, 0x8B, 0x1B, 0x02, 0x8C, 0x23, 0x02, 0x8D, 0x2B, 0x02, 0x8E, 0x33, 0x02, 0x8F, 0x3B,
+    0x02, 0x88, 0x04, 0x02, 0x89, 0x0C, 0x02, 0x8A, 0x14, 0x02, 0x8B, 0x1C, 0x02, 0x8C, 0x24, 0x02,
+    0x8D, 0x2C, 0x02, 0x8E, 0x34, 0x02, 0x8F, 0x3C, 0x02, 0x88, 0x05, 0x02, 0x89, 0x0D, 0x02, 0x8A,
+    0x15, 0x02, 0x8B, 0x1D, 0x02, 0x8C, 0x25, 0x02, 0x8D, 0x2D, 0x02, 0x8E, 0x35, 0x02, 0x8F, 0x3D,
+    0x02, 0x88, 0x06, 0x02, 0x89, 0x0E, 0x02, 0x8A, 0x16, 0x02, 0x8B, 0x1E, 0x02, 0x8C, 0x26, 0x02,
+    0x8D, 0x2E, 0x02, 0x8E, 0x36, 0x02, 0x8F, 0x3E, 0x02, 0x88, 0x07, 0x02, 0x89, 0x0F, 0x02, 0x8A,
+    0x17, 0x02, 0x8B, 0x1F, 0x02, 0x8C, 0x27, 0x02, 0x8D, 0x2F, 0x02, 0x8E, 0x37, 0x02, 0x8F, 0x3F,
+    0x02, 0x90, 0x00, 0x02, 0x91, 0x08, 0x02, 0x92, 0x10, 0x02, 0x93, 0x18, 0x02, 0x94, 0x20, 0x02,
+    0x95, 0x28, 0x02, 0x96, 0x30, 0x02, 0x97, 0x38, 0x02, 0x90, 0x01, 0x02, 0x91, 0x09, 0x02, 0x92,
+    0x11, 0x02, 0x93, 0x19, 0x02, 0x94, 0x21, 0x02, 0x95, 0x29, 0x02, 0x96, 0x31, 0x02, 0x97, 0x39,
+    0x02, 0x90, 0x02, 0x02, 0x91, 0x0A, 0x02, 0x92, 0x12, 0x02, 0x93, 0x1A, 0x02, 0x94, 0x22, 0x02,
+    0x95, 0x2A, 0x02, 0x96, 0x32, 0x02, 0x97, 0x3A, 0x02, 0x90, 0x03, 0x02, 0x91, 0x0B, 0x02, 0x92,
+    0x13, 0x02, 0x93, 0x1B, 0x02, 0x94, 0x23, 0x02, 0x95, 0x2B, 0x02, 0x96, 0x33, 0x02, 0x97, 0x3B,
+    0x02, 0x90, 0x04, 0x02, 0x91, 0x0C, 0x02, 0x92, 0x14, 0x02, 0x93, 0x1C, 0x02, 0x94, 0x24, 0x02,
+    0x95, 0x2C, 0x02, 0x96, 0x34, 0x02, 0x97, 0x3C, 0x02, 0x90, 0x05, 0x02, 0x91, 0x0D, 0x02, 0x92,
+    0x15, 0x02, 0x93, 0x1D, 0x02, 0x94, 0x25, 0x02, 0x95, 0x2D, 0x02, 0x96, 0x35, 0x02, 0x97, 0x3D,
+    0x02, 0x90, 0x06, 0x02, 0x91, 0x0E, 0x02, 0x92, 0x16, 0x02, 0x93, 0x1E, 0x02, 0x94, 0x26, 0x02,
+    0x95, 0x2E, 0x02, 0x96, 0x36, 0x02, 0x97, 0x3E, 0x02, 0x90, 0x07, 0x02, 0x91, 0x0F, 0x02, 0x92,
+    0x17, 0x02, 0x93, 0x1F, 0x02, 0x94, 0x27, 0x02, 0x95, 0x2F, 0x02, 0x96, 0x37, 0x02, 0x97, 0x3F,
+    0x02, 0x98, 0x00, 0x02, 0x99, 0x08, 0x02, 0x9A, 0x10, 0x02, 0x9B, 0x18, 0x02, 0x9C, 0x20, 0x02,
+    0x9D, 0x28, 0x02, 0x9E, 0x30, 0x02, 0x9F, 0x38, 0x02, 0x98, 0x01, 0x02, 0x99, 0x09, 0x02, 0x9A,
+    0x11, 0x02, 0x9B, 0x19, 0x02, 0x9C, 0x21, 0x02, 0x9D, 0x29, 0x02, 0x9E, 0x31, 0x02, 0x9F, 0x39,
+    0x02, 0x98, 0x02, 0x02, 0x99, 0x0A, 0x02, 0x9A, 0x12, 0x02, 0x9B, 0x1A, 0x02, 0x9C, 0x22, 0x02,
+    0x9D, 0x2A, 0x02, 0x9E, 0x32, 0x02, 0x9F, 0x3A, 0x02, 0x98, 0x03, 0x02, 0x99, 0x0B, 0x02, 0x9A,
+    0x13, 0x02, 0x9B, 0x1B, 0x02, 0x9C, 0x23, 0x02, 0x9D, 0x2B, 0x02, 0x9E, 0x33, 0x02, 0x9F, 0x3B,
+    0x02, 0x98, 0x04, 0x02, 0x99, 0x0C, 0x02, 0x9A, 0x14, 0x02, 0x9B, 0x1C, 0x02, 0x9C, 0x24, 0x02,
+    0x9D, 0x2C, 0x02, 0x9E, 0x34, 0x02, 0x9F, 0x3C, 0x02, 0x98, 0x05, 0x02, 0x99, 0x0D, 0x02, 0x9A,
+    0x15, 0x02, 0x9B, 0x1D, 0x02, 0x9C, 0x25, 0x02, 0x9D, 0x2D, 0x02, 0x9E, 0x35, 0x02, 0x9F, 0x3D,
+    0x02, 0x98, 0x06, 0x02, 0x99, 0x0E, 0x02, 0x9A, 0x16, 0x02, 0x9B, 0x1E, 0x02, 0x9C, 0x26, 0x02,
+    0x9D, 0x2E, 0x02, 0x9E, 0x36, 0x02, 0x9F, 0x3E, 0x02, 0x98, 0x07, 0x02, 0x99, 0x0F, 0x02, 0x9A,
+    0x17, 0x02, 0x9B, 0x1F, 0x02, 0x9C, 0x27, 0x02, 0x9D, 0x2F, 0x02, 0x9E, 0x37, 0x02, 0x9F, 0x3F
+};
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+
+#include "pathfinding.h"
+#include "csr_graph.h"
+
+using namespace std;
+
+// Routes a whole list of requests in order, sharing BFS work between requests from the same source pin.
+//
+// For every source a full BFS tree is kept (no early exit). The parent a full BFS gives the end vertex
+// is the same one the early-exit findPathBFS would give, so paths are identical to calling findPathBFS
+// for each request in turn. A tree only goes stale when a pin it reached gets reserved; pins it never
+// reached can't change its shape. Failed requests reserve nothing, so runs of misses share one tree.
+class BatchRouter
+{
+    struct SourceTree
+    {
+        bool built = false;
+        size_t checkedUpTo = 0; // graph.usedPinsCount() when the tree was last known to be valid
+        PinBitset reached;
+        vector<int> parent;
+
+        SourceTree(int vertices) : reached(vertices), parent(vertices, -1) {}
+    };
+
+    CSRGraph &graph;
+    vector<SourceTree *> trees; // Indexed by source vertex, built on first use
+    vector<int> bfsQueue;
+
+    bool isStale(const SourceTree &tree) const
+    {
+        for (size_t i = tree.checkedUpTo; i < graph.usedPinsCount(); i++)
+        {
+            if (tree.reached.test(graph.usedPinAt(i)))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void buildTree(int source, SourceTree &tree)
+    {
+        tree.reached.clear();
+        int head = 0, tail = 0;
+        tree.reached.set(source);
+        tree.parent[source] = -1;
+        bfsQueue[tail++] = source;
+
+        while (head < tail)
+        {
+            int current = bfsQueue[head++];
+            for (const int *it = graph.neighboursBegin(current), *end = graph.neighboursEnd(current); it != end; ++it)
+            {
+                int adjVertex = *it;
+                if (!tree.reached.test(adjVertex) && (!graph.isPinUsed(adjVertex) || graph.isSpecialPin(adjVertex)))
+                {
+                    tree.parent[adjVertex] = current;
+                    tree.reached.set(adjVertex);
+                    bfsQueue[tail++] = adjVertex;
+                }
+            }
+        }
+
+        tree.built = true;
+        tree.checkedUpTo = graph.usedPinsCount();
+        treesBuilt++;
+    }
+
+public:
+    int treesBuilt = 0;  // Full BFS runs
+    int treesReused = 0; // Requests answered from an existing tree
+
+    BatchRouter(CSRGraph &g) : graph(g), trees(g.vertexCount(), nullptr), bfsQueue(g.vertexCount()) {}
+    BatchRouter(const BatchRouter &) = delete;
+    BatchRouter &operator=(const BatchRouter &) = delete;
+
+    ~BatchRouter()
+    {
+        for (SourceTree *tree : trees)
+        {
+            delete tree;
+        }
+    }
+
+    // Drops all cached trees, call after graph.clearUsedPins()
+    void reset()
+    {
+        for (SourceTree *tree : trees)
+        {
+            if (tree)
+            {
+                tree->built = false;
+            }
+        }
+        treesBuilt = 0;
+        treesReused = 0;
+    }
+
+    // Routes (start, end) vertex pairs in order and reserves the pins of every path found.
+    // paths[i] is empty when request i could not be routed.
+    vector<vector<int>> routeBatch(const vector<pair<int, int>> &requests)
+    {
+        vector<vector<int>> paths(requests.size());
+
+        for (size_t r = 0; r < requests.size(); r++)
+        {
+            int startVertex = requests[r].first;
+            int endVertex = requests[r].second;
+
+            if (!trees[startVertex])
+            {
+                trees[startVertex] = new SourceTree(graph.vertexCount());
+            }
+            SourceTree &tree = *trees[startVertex];
+
+            if (!tree.built || isStale(tree))
+            {
+                buildTree(startVertex, tree);
+            }
+            else
+            {
+                tree.checkedUpTo = graph.usedPinsCount();
+                treesReused++;
+            }
+
+            if (startVertex == endVertex || !tree.reached.test(endVertex))
+            {
+                continue; // No path found
+            }
+
+            vector<int> &path = paths[r];
+            for (int at = endVertex; at != -1; at = tree.parent[at])
+            {
+                path.push_back(at);
+            }
+            reverse(path.begin(), path.end());
+            graph.reservePath(path);
+        }
+
+        return paths;
+    }
+
+    vector<vector<int>> routeBatch(const vector<PathRequest> &requests)
+    {
+        return routeBatch(requestVertices(requests));
+    }
+};
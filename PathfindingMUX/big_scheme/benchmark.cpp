@@ -0,0 +1,433 @@
+// Benchmarks for the big scheme router on the 18-MUX topology from main.cpp.
+// Build and run: g++ -O2 -std=c++14 -pthread benchmark.cpp -o benchmark && ./benchmark
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <functional>
+
+#include "pathfinding.h"
+#include "csr_graph.h"
+#include "board.h"
+#include "batch_router.h"
+#include "negotiated_router.h"
+#include "parallel_router.h"
+
+using namespace std;
+
+const int NUM_VERTICES = BOARD_VERTICES;
+
+struct Board
+{
+    Multiplexer all_muxes[18] = {Multiplexer(0), Multiplexer(1), Multiplexer(2), Multiplexer(3), Multiplexer(4), Multiplexer(5), Multiplexer(6), Multiplexer(7), Multiplexer(8),
+                                 Multiplexer(9), Multiplexer(10), Multiplexer(11), Multiplexer(12), Multiplexer(13), Multiplexer(14), Multiplexer(15), Multiplexer(16), Multiplexer(17)};
+    Breadboard main_breadboard{19};
+    Breadboard mcu_breadboard{20};
+};
+
+// Average microseconds per call of fn over the given number of runs
+double timeMicros(int runs, const function<void()> &fn)
+{
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < runs; i++)
+    {
+        fn();
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, micro>(end - start).count() / runs;
+}
+
+// The 64x40 sweep from main(), as vertex pairs
+vector<pair<int, int>> sweepRequests(Board &board)
+{
+    vector<pair<int, int>> requests;
+    for (int i = 0; i < 64; i++)
+    {
+        for (int j = 0; j < 40; j++)
+        {
+            requests.push_back(make_pair(getGraphVertexID(&board.main_breadboard, 'p', i),
+                                         getGraphVertexID(&board.mcu_breadboard, 'p', j)));
+        }
+    }
+    return requests;
+}
+
+template <typename GraphType>
+int runSweep(GraphType &g, const vector<pair<int, int>> &requests, vector<vector<int>> *paths = nullptr)
+{
+    g.clearUsedPins();
+    int found = 0;
+    for (const auto &request : requests)
+    {
+        vector<int> path = g.findPathBFS(request.first, request.second);
+        found += !path.empty();
+        if (paths)
+        {
+            paths->push_back(path);
+        }
+    }
+    return found;
+}
+
+// getGraphVertexID and ConnectionNode::print as they were before the device tag, kept as the baseline
+int getGraphVertexIDDynamicCast(const Device *device, char type, int pinIndex)
+{
+    if (dynamic_cast<const Multiplexer *>(device))
+    {
+        return device->num * 24 + (type == 'x' ? pinIndex : 16 + pinIndex);
+    }
+    else if (dynamic_cast<const Breadboard *>(device))
+    {
+        if (device->num == 19)
+        {
+            return 18 * 24 + pinIndex;
+        }
+        if (device->num == 20)
+        {
+            return 18 * 24 + 64 + pinIndex;
+        }
+    }
+    return -1;
+}
+
+void printDynamicCast(const ConnectionNode &node)
+{
+    if (dynamic_cast<Multiplexer *>(node.device))
+    {
+        cout << "MUX_" << node.device->num << "." << node.connectionType << "[" << node.index << "]";
+    }
+    else if (dynamic_cast<Breadboard *>(node.device))
+    {
+        cout << "Breadboard_" << node.device->num << ".pin[" << node.index << "]";
+    }
+}
+
+// Graph build through getGraphVertexID (every X to Y edge of every MUX) and printing of every pin node
+void benchmarkVertexIDs(Board &board)
+{
+    const int runs = 200;
+
+    auto buildWith = [&](int (*vertexID)(const Device *, char, int)) {
+        CSRGraph g(NUM_VERTICES);
+        for (int i = 0; i < 18; i++)
+        {
+            for (int j = 0; j < 16; j++)
+            {
+                for (int k = 0; k < 8; k++)
+                {
+                    g.addEdge(vertexID(&board.all_muxes[i], 'x', j), vertexID(&board.all_muxes[i], 'y', k));
+                }
+            }
+        }
+        g.freeze();
+        return g.edgeCount();
+    };
+
+    int sum = 0;
+    double castLookup = timeMicros(runs, [&]() {
+        for (int i = 0; i < 18; i++)
+            for (int j = 0; j < 24; j++)
+                sum += getGraphVertexIDDynamicCast(&board.all_muxes[i], j < 16 ? 'x' : 'y', j < 16 ? j : j - 16);
+        for (int p = 0; p < 64; p++)
+            sum += getGraphVertexIDDynamicCast(&board.main_breadboard, 'p', p);
+        for (int p = 0; p < 40; p++)
+            sum += getGraphVertexIDDynamicCast(&board.mcu_breadboard, 'p', p);
+    });
+    double tagLookup = timeMicros(runs, [&]() {
+        for (int i = 0; i < 18; i++)
+            for (int j = 0; j < 24; j++)
+                sum += getGraphVertexID(&board.all_muxes[i], j < 16 ? 'x' : 'y', j < 16 ? j : j - 16);
+        for (int p = 0; p < 64; p++)
+            sum += getGraphVertexID(&board.main_breadboard, 'p', p);
+        for (int p = 0; p < 40; p++)
+            sum += getGraphVertexID(&board.mcu_breadboard, 'p', p);
+    });
+
+    double castBuild = timeMicros(runs, [&]() { sum += buildWith(getGraphVertexIDDynamicCast); });
+    double tagBuild = timeMicros(runs, [&]() { sum += buildWith(getGraphVertexID); });
+
+    // One node per graph vertex, printed into a discarding stream
+    vector<ConnectionNode> nodes;
+    for (int i = 0; i < 18; i++)
+    {
+        for (int j = 0; j < 24; j++)
+        {
+            nodes.push_back(ConnectionNode(&board.all_muxes[i], j < 16 ? j : j - 16, j < 16 ? 'x' : 'y'));
+        }
+    }
+    for (int p = 0; p < 64; p++)
+    {
+        nodes.push_back(ConnectionNode(&board.main_breadboard, p, 'p'));
+    }
+    for (int p = 0; p < 40; p++)
+    {
+        nodes.push_back(ConnectionNode(&board.mcu_breadboard, p, 'p'));
+    }
+
+    streambuf *coutBuffer = cout.rdbuf(nullptr);
+    double castPrint = timeMicros(runs, [&]() {
+        for (const auto &node : nodes)
+            printDynamicCast(node);
+    });
+    double tagPrint = timeMicros(runs, [&]() {
+        for (const auto &node : nodes)
+            node.print();
+    });
+    cout.rdbuf(coutBuffer);
+
+    cout << "Vertex IDs (" << NUM_VERTICES << " lookups, " << 18 * 16 * 8 << " edge build, " << nodes.size() << " nodes printed)" << endl;
+    cout << "  dynamic_cast  lookup: " << castLookup << " us   build: " << castBuild << " us   print: " << castPrint << " us" << endl;
+    cout << "  device tag    lookup: " << tagLookup << " us   build: " << tagBuild << " us   print: " << tagPrint << " us" << endl;
+    cout << "  lookup speedup: " << castLookup / tagLookup << "x   (checksum " << sum % 1000 << ")" << endl;
+}
+
+// printDeviceSpecifications as it was: console output plus to_string concatenation
+string printDeviceSpecificationsToString(int vertexID)
+{
+    if (vertexID < 18 * 24)
+    {
+        int pinIndex = vertexID % 24;
+        char type = pinIndex < 16 ? 'x' : 'y';
+        pinIndex = pinIndex < 16 ? pinIndex : pinIndex - 16;
+        cout << " -> MUX" << vertexID / 24 + 1 << " " << type << pinIndex;
+        return " -> MUX" + to_string(vertexID / 24 + 1) + " " + type + to_string(pinIndex);
+    }
+    else if (vertexID < 18 * 24 + 64)
+    {
+        cout << " -> MainBreadboard " << vertexID - 18 * 24 + 1;
+        return " -> MainBreadboard " + to_string(vertexID - 18 * 24 + 1);
+    }
+    cout << " -> MCUBreadboard " << vertexID - 18 * 24 - 64 + 1;
+    return " -> MCUBreadboard " + to_string(vertexID - 18 * 24 - 64 + 1);
+}
+
+void benchmarkVertexLabels()
+{
+    const int runs = 2000;
+    size_t length = 0;
+    bool same = true;
+    for (int v = 0; v < NUM_VERTICES; v++)
+    {
+        char label[VERTEX_LABEL_SIZE];
+        formatVertexLabel(label, v);
+        streambuf *coutBuffer = cout.rdbuf(nullptr);
+        same = same && printDeviceSpecificationsToString(v) == label;
+        cout.rdbuf(coutBuffer);
+    }
+
+    streambuf *coutBuffer = cout.rdbuf(nullptr);
+    double stringLabels = timeMicros(runs, [&]() {
+        for (int v = 0; v < NUM_VERTICES; v++)
+            length += printDeviceSpecificationsToString(v).size();
+    });
+    cout.rdbuf(coutBuffer);
+    double bufferLabels = timeMicros(runs, [&]() {
+        char label[VERTEX_LABEL_SIZE];
+        for (int v = 0; v < NUM_VERTICES; v++)
+            length += formatVertexLabel(label, v);
+    });
+
+    cout << "Vertex labels (" << NUM_VERTICES << " per run)" << endl;
+    cout << "  cout + to_string:   " << NUM_VERTICES / stringLabels << " M labels/s" << endl;
+    cout << "  formatVertexLabel:  " << NUM_VERTICES / bufferLabels << " M labels/s   same text: " << (same ? "yes" : "NO")
+         << "   (checksum " << length % 1000 << ")" << endl;
+}
+
+void benchmarkGraphLayouts(Board &board)
+{
+    const int runs = 50;
+    vector<pair<int, int>> requests = sweepRequests(board);
+
+    // Graph::findPathBFS prints every miss, keep that out of the numbers
+    streambuf *coutBuffer = cout.rdbuf(nullptr);
+
+    double listBuild = timeMicros(runs, [&]() {
+        Graph g(NUM_VERTICES);
+        addBoardEdges(g);
+    });
+    double csrBuild = timeMicros(runs, [&]() {
+        CSRGraph g(NUM_VERTICES);
+        addBoardEdges(g);
+        g.freeze();
+    });
+    double tableBuild = timeMicros(runs, [&]() { CSRGraph g(NUM_VERTICES, boardCSR.offsets, boardCSR.neighbours); });
+
+    Graph listGraph(NUM_VERTICES);
+    addBoardEdges(listGraph);
+    CSRGraph csrGraph(NUM_VERTICES);
+    addBoardEdges(csrGraph);
+    csrGraph.freeze();
+
+    CSRGraph tableGraph(NUM_VERTICES, boardCSR.offsets, boardCSR.neighbours);
+
+    vector<vector<int>> listPaths, csrPaths, tablePaths;
+    int listFound = runSweep(listGraph, requests, &listPaths);
+    int csrFound = runSweep(csrGraph, requests, &csrPaths);
+    runSweep(tableGraph, requests, &tablePaths);
+
+    double listSweep = timeMicros(runs, [&]() { runSweep(listGraph, requests); });
+    double csrSweep = timeMicros(runs, [&]() { runSweep(csrGraph, requests); });
+
+    cout.rdbuf(coutBuffer);
+
+    cout << "Graph layout (" << NUM_VERTICES << " vertices, " << csrGraph.edgeCount() << " edges, "
+         << requests.size() << " requests)" << endl;
+    cout << "  list<int> build: " << listBuild << " us   sweep: " << listSweep << " us   paths found: " << listFound << endl;
+    cout << "  CSR       build: " << csrBuild << " us   sweep: " << csrSweep << " us   paths found: " << csrFound << endl;
+    cout << "  CSR from constexpr table build: " << tableBuild << " us (BFS scratch only)   same paths: "
+         << (tablePaths == csrPaths ? "yes" : "NO") << endl;
+    cout << "  sweep speedup: " << listSweep / csrSweep << "x   same paths: " << (listPaths == csrPaths ? "yes" : "NO") << endl;
+}
+
+void benchmarkBatchRouter(Board &board)
+{
+    const int runs = 50;
+    vector<pair<int, int>> requests = sweepRequests(board);
+
+    CSRGraph g(NUM_VERTICES, boardCSR.offsets, boardCSR.neighbours);
+    BatchRouter router(g);
+
+    vector<vector<int>> loopPaths;
+    int loopFound = runSweep(g, requests, &loopPaths);
+
+    g.clearUsedPins();
+    router.reset();
+    vector<vector<int>> batchPaths = router.routeBatch(requests);
+    int batchFound = 0;
+    for (const auto &path : batchPaths)
+    {
+        batchFound += !path.empty();
+    }
+
+    double loopSweep = timeMicros(runs, [&]() { runSweep(g, requests); });
+    double batchSweep = timeMicros(runs, [&]() {
+        g.clearUsedPins();
+        router.reset();
+        router.routeBatch(requests);
+    });
+
+    cout << "Batch router (" << requests.size() << " requests)" << endl;
+    cout << "  findPathBFS loop: " << loopSweep << " us   paths found: " << loopFound << endl;
+    cout << "  routeBatch:       " << batchSweep << " us   paths found: " << batchFound
+         << "   BFS trees built: " << router.treesBuilt << "   reused: " << router.treesReused << endl;
+    cout << "  speedup: " << loopSweep / batchSweep << "x   same paths: " << (loopPaths == batchPaths ? "yes" : "NO") << endl;
+}
+
+NegotiatedRouter::Stats benchmarkNegotiatedRouter(const char *name, const vector<pair<int, int>> &requests)
+{
+    CSRGraph g(NUM_VERTICES, boardCSR.offsets, boardCSR.neighbours);
+
+    BatchRouter greedy(g);
+    vector<vector<int>> greedyPaths;
+    double greedyMicros = timeMicros(1, [&]() { greedyPaths = greedy.routeBatch(requests); });
+    int greedyFound = 0;
+    for (const auto &path : greedyPaths)
+    {
+        greedyFound += !path.empty();
+    }
+
+    g.clearUsedPins();
+    NegotiatedRouter negotiated(g);
+    negotiated.route(requests);
+    const NegotiatedRouter::Stats &stats = negotiated.stats;
+
+    double slowestIteration = 0;
+    for (double micros : stats.iterationMicros)
+    {
+        slowestIteration = max(slowestIteration, micros);
+    }
+
+    cout << "Negotiated congestion router, " << name << " (" << requests.size() << " requests)" << endl;
+    cout << "  greedy BFS:  " << greedyMicros << " us   paths found: " << greedyFound << endl;
+    cout << "  negotiated:  " << stats.totalMicros << " us   paths found: " << stats.routed
+         << "   iterations: " << stats.iterations << (stats.converged ? " (converged)" : " (not converged)")
+         << "   reroutes: " << stats.reroutes << "   routed by the final BFS: " << stats.fallbackRouted << endl;
+    cout << "  per iteration: " << stats.totalMicros / stats.iterations << " us avg, " << slowestIteration << " us max"
+         << "   overused pins after first/last iteration: " << stats.overusedPins.front() << "/" << stats.overusedPins.back() << endl;
+    return stats;
+}
+
+// Main pin shift + i to MCU pin i for i < 40
+vector<pair<int, int>> shiftedRequests(Board &board, int shift)
+{
+    vector<pair<int, int>> requests;
+    for (int i = 0; i < 40; i++)
+    {
+        requests.push_back(make_pair(getGraphVertexID(&board.main_breadboard, 'p', i + shift), getGraphVertexID(&board.mcu_breadboard, 'p', i)));
+    }
+    return requests;
+}
+
+void benchmarkParallelRouter(Board &board)
+{
+    const int runs = 20;
+    vector<pair<int, int>> requests = sweepRequests(board);
+
+    CSRGraph g(NUM_VERTICES, boardCSR.offsets, boardCSR.neighbours);
+
+    double loopSweep = timeMicros(runs, [&]() { runSweep(g, requests); });
+
+    cout << "Parallel router (" << requests.size() << " requests, " << thread::hardware_concurrency() << " hardware threads)" << endl;
+    cout << "  findPathBFS loop: " << loopSweep << " us" << endl;
+
+    for (unsigned seed : {0u, 42u})
+    {
+        vector<vector<int>> reference;
+        for (int threads : {1, 2, 4, 8, 16})
+        {
+            ParallelRouter router(g, threads);
+            router.seed = seed;
+            vector<vector<int>> paths;
+            double micros = timeMicros(runs, [&]() {
+                g.clearUsedPins();
+                paths = router.route(requests);
+            });
+
+            int found = 0;
+            for (const auto &path : paths)
+            {
+                found += !path.empty();
+            }
+            if (reference.empty())
+            {
+                reference = paths;
+            }
+
+            cout << "  seed " << seed << ", " << threads << " threads: " << micros << " us   paths found: " << found
+                 << "   searches: " << router.searches << "   retries: " << router.retries
+                 << "   same as 1 thread: " << (paths == reference ? "yes" : "NO") << endl;
+        }
+    }
+}
+
+int main()
+{
+    Board board;
+
+    benchmarkVertexIDs(board);
+    benchmarkVertexLabels();
+    benchmarkGraphLayouts(board);
+    benchmarkBatchRouter(board);
+    benchmarkParallelRouter(board);
+
+    // Every main pin to every MCU pin, then two netlists of 40 nets. Main pin i to MCU pin i can't
+    // all fit: the 35 nets that don't take the direct MUX 10-14 to MUX 0-4 wire must go through a hub
+    // MUX (5-9), and every net that enters a hub takes one of its 8 Y pins. Hubs 8 and 9 have only
+    // 10 X pins wired to MUXes 10-14, so at least 25 nets need the 24 Y pins of hubs 5-7 and 39 is
+    // the most that can be routed. Main pins 16-55 (MUXes 12-16) to MCU pins 0-39 fit.
+    benchmarkNegotiatedRouter("64x40 sweep", sweepRequests(board));
+    NegotiatedRouter::Stats oneToOne = benchmarkNegotiatedRouter("one-to-one", shiftedRequests(board, 0));
+    NegotiatedRouter::Stats shifted = benchmarkNegotiatedRouter("main pin i + 16 to MCU pin i", shiftedRequests(board, 16));
+
+    bool ok = true;
+    if (!oneToOne.converged || oneToOne.routed != 39)
+    {
+        cout << "FAILED: one-to-one should converge with 39 of 40 nets routed" << endl;
+        ok = false;
+    }
+    if (!shifted.converged || shifted.routed != 40)
+    {
+        cout << "FAILED: main pin i + 16 to MCU pin i should converge with all 40 nets routed" << endl;
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
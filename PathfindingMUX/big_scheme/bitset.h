@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+using namespace std;
+
+// Fixed-size set of vertex IDs packed 64 per word
+class PinBitset
+{
+    vector<uint64_t> words;
+
+public:
+    PinBitset(int size) : words((size + 63) / 64, 0) {}
+
+    bool test(int pin) const
+    {
+        return (words[pin >> 6] >> (pin & 63)) & 1;
+    }
+
+    void set(int pin)
+    {
+        words[pin >> 6] |= uint64_t(1) << (pin & 63);
+    }
+
+    void reset(int pin)
+    {
+        words[pin >> 6] &= ~(uint64_t(1) << (pin & 63));
+    }
+
+    void clear()
+    {
+        fill(words.begin(), words.end(), 0);
+    }
+};
+
+// Packed bitset that is cleared in O(1).
+// Every word carries the epoch it was last written in; a word from an older epoch
+// reads as all zeros, so clear() only has to bump the epoch.
+class EpochBitset
+{
+    vector<uint64_t> words;
+    vector<uint32_t> wordEpochs;
+    uint32_t epoch;
+
+public:
+    EpochBitset(int size) : words((size + 63) / 64, 0), wordEpochs((size + 63) / 64, 0), epoch(1) {}
+
+    bool test(int pin) const
+    {
+        int w = pin >> 6;
+        return wordEpochs[w] == epoch && ((words[w] >> (pin & 63)) & 1);
+    }
+
+    void set(int pin)
+    {
+        int w = pin >> 6;
+        if (wordEpochs[w] != epoch)
+        {
+            wordEpochs[w] = epoch;
+            words[w] = 0;
+        }
+        words[w] |= uint64_t(1) << (pin & 63);
+    }
+
+    void clear()
+    {
+        if (++epoch == 0)
+        {
+            // The epoch wrapped around, old tags could match again
+            fill(wordEpochs.begin(), wordEpochs.end(), 0);
+            epoch = 1;
+        }
+    }
+};
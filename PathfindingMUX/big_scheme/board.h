@@ -0,0 +1,370 @@
+#pragma once
+
+#include <utility>
+
+#include "pathfinding.h"
+
+// Wiring of the 18 CH446Q multiplexers and the two breadboards of the big scheme as a constant table.
+// Vertices use the muxX / muxY / mainPin / mcuPin numbering of pathfinding.h; mux is the all_muxes index, so MUX1 is 0.
+
+constexpr int BOARD_VERTICES = 18 * 24 + 1 * 64 + 1 * 40;
+
+// Board wires, one vertex pair per wire. Every X to Y connection inside a MUX is implied and not listed.
+constexpr int boardWires[][2] = {
+    // MUX1 pins edge connections
+    {muxX(0, 0), muxX(10, 0)},
+    {muxX(0, 1), muxX(11, 0)},
+    {muxX(0, 2), muxX(12, 0)},
+    {muxX(0, 3), muxX(13, 0)},
+    {muxX(0, 4), muxX(14, 0)},
+    {muxX(0, 5), muxX(15, 0)},
+    {muxX(0, 6), muxX(16, 0)},
+    {muxX(0, 7), muxX(17, 0)},
+    {muxX(0, 8), muxY(5, 0)},
+    {muxX(0, 9), muxY(6, 0)},
+    {muxX(0, 10), muxY(7, 0)},
+    {muxX(0, 11), muxY(8, 0)},
+    {muxX(0, 12), muxY(9, 0)},
+    {muxX(0, 13), muxY(5, 5)},
+    {muxX(0, 14), muxY(5, 6)},
+    {muxX(0, 15), muxY(5, 7)},
+    {muxY(0, 0), mcuPin(0)},
+    {muxY(0, 1), mcuPin(1)},
+    {muxY(0, 2), mcuPin(2)},
+    {muxY(0, 3), mcuPin(3)},
+    {muxY(0, 4), mcuPin(4)},
+    {muxY(0, 5), mcuPin(5)},
+    {muxY(0, 6), mcuPin(6)},
+    {muxY(0, 7), mcuPin(7)},
+
+    // MUX2 pins edge connections
+    {muxX(1, 0), muxX(10, 1)},
+    {muxX(1, 1), muxX(11, 1)},
+    {muxX(1, 2), muxX(12, 1)},
+    {muxX(1, 3), muxX(13, 1)},
+    {muxX(1, 4), muxX(14, 1)},
+    {muxX(1, 5), muxX(15, 1)},
+    {muxX(1, 6), muxX(16, 1)},
+    {muxX(1, 7), muxX(17, 1)},
+    {muxX(1, 8), muxY(5, 1)},
+    {muxX(1, 9), muxY(6, 1)},
+    {muxX(1, 10), muxY(7, 1)},
+    {muxX(1, 11), muxY(8, 1)},
+    {muxX(1, 12), muxY(9, 1)},
+    {muxX(1, 13), muxY(6, 5)},
+    {muxX(1, 14), muxY(6, 6)},
+    {muxX(1, 15), muxY(6, 7)},
+    {muxY(1, 0), mcuPin(8)},
+    {muxY(1, 1), mcuPin(9)},
+    {muxY(1, 2), mcuPin(10)},
+    {muxY(1, 3), mcuPin(11)},
+    {muxY(1, 4), mcuPin(12)},
+    {muxY(1, 5), mcuPin(13)},
+    {muxY(1, 6), mcuPin(14)},
+    {muxY(1, 7), mcuPin(15)},
+
+    // MUX3 pins edge connections
+    {muxX(2, 0), muxX(10, 2)},
+    {muxX(2, 1), muxX(11, 2)},
+    {muxX(2, 2), muxX(12, 2)},
+    {muxX(2, 3), muxX(13, 2)},
+    {muxX(2, 4), muxX(14, 2)},
+    {muxX(2, 5), muxX(15, 2)},
+    {muxX(2, 6), muxX(16, 2)},
+    {muxX(2, 7), muxX(17, 2)},
+    {muxX(2, 8), muxY(5, 2)},
+    {muxX(2, 9), muxY(6, 2)},
+    {muxX(2, 10), muxY(7, 2)},
+    {muxX(2, 11), muxY(8, 2)},
+    {muxX(2, 12), muxY(9, 2)},
+    {muxX(2, 13), muxY(7, 5)},
+    {muxX(2, 14), muxY(7, 6)},
+    {muxX(2, 15), muxY(7, 7)},
+    {muxY(2, 0), mcuPin(16)},
+    {muxY(2, 1), mcuPin(17)},
+    {muxY(2, 2), mcuPin(18)},
+    {muxY(2, 3), mcuPin(19)},
+    {muxY(2, 4), mcuPin(20)},
+    {muxY(2, 5), mcuPin(21)},
+    {muxY(2, 6), mcuPin(22)},
+    {muxY(2, 7), mcuPin(23)},
+
+    // MUX4 pins edge connections
+    {muxX(3, 0), muxX(10, 3)},
+    {muxX(3, 1), muxX(11, 3)},
+    {muxX(3, 2), muxX(12, 3)},
+    {muxX(3, 3), muxX(13, 3)},
+    {muxX(3, 4), muxX(14, 3)},
+    {muxX(3, 5), muxX(15, 3)},
+    {muxX(3, 6), muxX(16, 3)},
+    {muxX(3, 7), muxX(17, 3)},
+    {muxX(3, 8), muxY(5, 3)},
+    {muxX(3, 9), muxY(6, 3)},
+    {muxX(3, 10), muxY(7, 3)},
+    {muxX(3, 11), muxY(8, 3)},
+    {muxX(3, 12), muxY(9, 3)},
+    {muxX(3, 13), muxY(8, 5)},
+    {muxX(3, 14), muxY(8, 6)},
+    {muxX(3, 15), muxY(8, 7)},
+    {muxY(3, 0), mcuPin(24)},
+    {muxY(3, 1), mcuPin(25)},
+    {muxY(3, 2), mcuPin(26)},
+    {muxY(3, 3), mcuPin(27)},
+    {muxY(3, 4), mcuPin(28)},
+    {muxY(3, 5), mcuPin(29)},
+    {muxY(3, 6), mcuPin(30)},
+    {muxY(3, 7), mcuPin(31)},
+
+    // MUX5 pins edge connections
+    {muxX(4, 0), muxX(10, 4)},
+    {muxX(4, 1), muxX(11, 4)},
+    {muxX(4, 2), muxX(12, 4)},
+    {muxX(4, 3), muxX(13, 4)},
+    {muxX(4, 4), muxX(14, 4)},
+    {muxX(4, 5), muxX(15, 4)},
+    {muxX(4, 6), muxX(16, 4)},
+    {muxX(4, 7), muxX(17, 4)},
+    {muxX(4, 8), muxY(5, 4)},
+    {muxX(4, 9), muxY(6, 4)},
+    {muxX(4, 10), muxY(7, 4)},
+    {muxX(4, 11), muxY(8, 4)},
+    {muxX(4, 12), muxY(9, 4)},
+    {muxX(4, 13), muxY(9, 5)},
+    {muxX(4, 14), muxY(9, 6)},
+    {muxX(4, 15), muxY(9, 7)},
+    {muxY(4, 0), mcuPin(32)},
+    {muxY(4, 1), mcuPin(33)},
+    {muxY(4, 2), mcuPin(34)},
+    {muxY(4, 3), mcuPin(35)},
+    {muxY(4, 4), mcuPin(36)},
+    {muxY(4, 5), mcuPin(37)},
+    {muxY(4, 6), mcuPin(38)},
+    {muxY(4, 7), mcuPin(39)},
+
+    // MUX6 pins edge connections
+    {muxX(5, 0), muxX(10, 5)},
+    {muxX(5, 1), muxX(11, 5)},
+    {muxX(5, 2), muxX(12, 5)},
+    {muxX(5, 3), muxX(13, 5)},
+    {muxX(5, 4), muxX(14, 5)},
+    {muxX(5, 5), muxX(15, 5)},
+    {muxX(5, 6), muxX(16, 5)},
+    {muxX(5, 7), muxX(17, 5)},
+    {muxX(5, 8), muxX(10, 10)},
+    {muxX(5, 9), muxX(10, 11)},
+    {muxX(5, 10), muxX(10, 12)},
+    {muxX(5, 11), muxX(11, 10)},
+    {muxX(5, 12), muxX(11, 11)},
+
+    // MUX7 pins edge connections
+    {muxX(6, 0), muxX(10, 6)},
+    {muxX(6, 1), muxX(11, 6)},
+    {muxX(6, 2), muxX(12, 6)},
+    {muxX(6, 3), muxX(13, 6)},
+    {muxX(6, 4), muxX(14, 6)},
+    {muxX(6, 5), muxX(15, 6)},
+    {muxX(6, 6), muxX(16, 6)},
+    {muxX(6, 7), muxX(17, 6)},
+    {muxX(6, 8), muxX(11, 12)},
+    {muxX(6, 9), muxX(12, 10)},
+    {muxX(6, 10), muxX(12, 11)},
+    {muxX(6, 11), muxX(12, 12)},
+    {muxX(6, 12), muxX(13, 10)},
+
+    // MUX8 pins edge connections
+    {muxX(7, 0), muxX(10, 7)},
+    {muxX(7, 1), muxX(11, 7)},
+    {muxX(7, 2), muxX(12, 7)},
+    {muxX(7, 3), muxX(13, 7)},
+    {muxX(7, 4), muxX(14, 7)},
+    {muxX(7, 5), muxX(15, 7)},
+    {muxX(7, 6), muxX(16, 7)},
+    {muxX(7, 7), muxX(17, 7)},
+    {muxX(7, 8), muxX(13, 11)},
+    {muxX(7, 9), muxX(13, 12)},
+    {muxX(7, 10), muxX(14, 10)},
+    {muxX(7, 11), muxX(14, 11)},
+    {muxX(7, 12), muxX(14, 12)},
+
+    // MUX9 pins edge connections
+    {muxX(8, 0), muxX(10, 8)},
+    {muxX(8, 1), muxX(11, 8)},
+    {muxX(8, 2), muxX(12, 8)},
+    {muxX(8, 3), muxX(13, 8)},
+    {muxX(8, 4), muxX(14, 8)},
+    {muxX(8, 5), muxX(15, 8)},
+    {muxX(8, 6), muxX(16, 8)},
+    {muxX(8, 7), muxX(17, 8)},
+    {muxX(8, 8), muxX(15, 10)},
+    {muxX(8, 9), muxX(15, 11)},
+    {muxX(8, 10), muxX(15, 12)},
+    {muxX(8, 11), muxX(16, 10)},
+    {muxX(8, 12), muxX(16, 11)},
+
+    // MUX10 pins edge connections
+    {muxX(9, 0), muxX(10, 9)},
+    {muxX(9, 1), muxX(11, 9)},
+    {muxX(9, 2), muxX(12, 9)},
+    {muxX(9, 3), muxX(13, 9)},
+    {muxX(9, 4), muxX(14, 9)},
+    {muxX(9, 5), muxX(15, 9)},
+    {muxX(9, 6), muxX(16, 9)},
+    {muxX(9, 7), muxX(17, 9)},
+    {muxX(9, 8), muxX(16, 12)},
+    {muxX(9, 9), muxX(17, 10)},
+    {muxX(9, 10), muxX(17, 11)},
+    {muxX(9, 11), muxX(17, 12)},
+
+    // MUX11 pins edge connections
+    // Connecting mux11 'y' outputs to main_breadboard 'p' pins, slots 0-7
+    {muxY(10, 0), mainPin(0)},
+    {muxY(10, 1), mainPin(1)},
+    {muxY(10, 2), mainPin(2)},
+    {muxY(10, 3), mainPin(3)},
+    {muxY(10, 4), mainPin(4)},
+    {muxY(10, 5), mainPin(5)},
+    {muxY(10, 6), mainPin(6)},
+    {muxY(10, 7), mainPin(7)},
+
+    // MUX12 pins edge connections
+    // Connecting mux12 'y' outputs to main_breadboard 'p' pins, slots 8-15
+    {muxY(11, 0), mainPin(8)},
+    {muxY(11, 1), mainPin(9)},
+    {muxY(11, 2), mainPin(10)},
+    {muxY(11, 3), mainPin(11)},
+    {muxY(11, 4), mainPin(12)},
+    {muxY(11, 5), mainPin(13)},
+    {muxY(11, 6), mainPin(14)},
+    {muxY(11, 7), mainPin(15)},
+
+    // MUX13 pins edge connections
+    // Connecting mux13 'y' outputs to main_breadboard 'p' pins, slots 16-23
+    {muxY(12, 0), mainPin(16)},
+    {muxY(12, 1), mainPin(17)},
+    {muxY(12, 2), mainPin(18)},
+    {muxY(12, 3), mainPin(19)},
+    {muxY(12, 4), mainPin(20)},
+    {muxY(12, 5), mainPin(21)},
+    {muxY(12, 6), mainPin(22)},
+    {muxY(12, 7), mainPin(23)},
+
+    // MUX14 pins edge connections
+    // Connecting mux14 'y' outputs to main_breadboard 'p' pins, slots 24-31
+    {muxY(13, 0), mainPin(24)},
+    {muxY(13, 1), mainPin(25)},
+    {muxY(13, 2), mainPin(26)},
+    {muxY(13, 3), mainPin(27)},
+    {muxY(13, 4), mainPin(28)},
+    {muxY(13, 5), mainPin(29)},
+    {muxY(13, 6), mainPin(30)},
+    {muxY(13, 7), mainPin(31)},
+
+    // MUX15 pins edge connections
+    // Connecting mux15 'y' outputs to main_breadboard 'p' pins, slots 32-39
+    {muxY(14, 0), mainPin(32)},
+    {muxY(14, 1), mainPin(33)},
+    {muxY(14, 2), mainPin(34)},
+    {muxY(14, 3), mainPin(35)},
+    {muxY(14, 4), mainPin(36)},
+    {muxY(14, 5), mainPin(37)},
+    {muxY(14, 6), mainPin(38)},
+    {muxY(14, 7), mainPin(39)},
+
+    // MUX16 pins edge connections
+    // Connecting mux16 'y' outputs to main_breadboard 'p' pins, slots 40-47
+    {muxY(15, 0), mainPin(40)},
+    {muxY(15, 1), mainPin(41)},
+    {muxY(15, 2), mainPin(42)},
+    {muxY(15, 3), mainPin(43)},
+    {muxY(15, 4), mainPin(44)},
+    {muxY(15, 5), mainPin(45)},
+    {muxY(15, 6), mainPin(46)},
+    {muxY(15, 7), mainPin(47)},
+
+    // MUX17 pins edge connections
+    // Connecting mux17 'y' outputs to main_breadboard 'p' pins, slots 48-55
+    {muxY(16, 0), mainPin(48)},
+    {muxY(16, 1), mainPin(49)},
+    {muxY(16, 2), mainPin(50)},
+    {muxY(16, 3), mainPin(51)},
+    {muxY(16, 4), mainPin(52)},
+    {muxY(16, 5), mainPin(53)},
+    {muxY(16, 6), mainPin(54)},
+    {muxY(16, 7), mainPin(55)},
+
+    // MUX18 pins edge connections
+    // Connecting mux18 'y' outputs to main_breadboard 'p' pins, slots 56-63
+    {muxY(17, 0), mainPin(56)},
+    {muxY(17, 1), mainPin(57)},
+    {muxY(17, 2), mainPin(58)},
+    {muxY(17, 3), mainPin(59)},
+    {muxY(17, 4), mainPin(60)},
+    {muxY(17, 5), mainPin(61)},
+    {muxY(17, 6), mainPin(62)},
+    {muxY(17, 7), mainPin(63)},
+
+    // MCU Breadboard pins edge connections
+    {muxX(5, 13), muxX(9, 15)},
+    {muxX(6, 14), muxX(5, 14)},
+    {muxX(7, 14), muxX(5, 15)},
+    {muxX(9, 14), muxX(6, 13)},
+    {muxX(8, 14), muxX(6, 15)},
+    {muxX(9, 13), muxX(7, 13)},
+    {muxX(8, 15), muxX(7, 15)},
+    {muxX(9, 12), muxX(8, 13)},
+};
+
+constexpr int BOARD_WIRES = sizeof(boardWires) / sizeof(boardWires[0]);
+constexpr int BOARD_EDGES = 18 * 16 * 8 + BOARD_WIRES;
+
+// Edge i of the board in the order the graph gets them: every X to Y connection of every MUX, then the wires
+constexpr pair<int, int> boardEdge(int i)
+{
+    return i < 18 * 16 * 8 ? pair<int, int>(muxX(i / 128, i / 8 % 16), muxY(i / 128, i % 8))
+                           : pair<int, int>(boardWires[i - 18 * 16 * 8][0], boardWires[i - 18 * 16 * 8][1]);
+}
+
+// Adjacency of the board in compressed sparse row form, computed by the compiler
+struct BoardCSR
+{
+    int offsets[BOARD_VERTICES + 1];
+    int neighbours[2 * BOARD_EDGES];
+
+    constexpr BoardCSR() : offsets(), neighbours()
+    {
+        for (int e = 0; e < BOARD_EDGES; e++)
+        {
+            offsets[boardEdge(e).first + 1]++;
+            offsets[boardEdge(e).second + 1]++;
+        }
+        for (int v = 0; v < BOARD_VERTICES; v++)
+        {
+            offsets[v + 1] += offsets[v];
+        }
+
+        // Same fill order as CSRGraph::freeze(), so paths match the addEdge built graphs
+        int next[BOARD_VERTICES] = {};
+        for (int v = 0; v < BOARD_VERTICES; v++)
+        {
+            next[v] = offsets[v];
+        }
+        for (int e = 0; e < BOARD_EDGES; e++)
+        {
+            neighbours[next[boardEdge(e).first]++] = boardEdge(e).second;
+            neighbours[next[boardEdge(e).second]++] = boardEdge(e).first;
+        }
+    }
+};
+
+constexpr BoardCSR boardCSR;
+static_assert(boardCSR.offsets[BOARD_VERTICES] == 2 * BOARD_EDGES, "every board edge is in the CSR table");
+
+// Adds the board edges to any graph with addEdge(), in the same order as boardCSR
+template <typename GraphType>
+void addBoardEdges(GraphType &g)
+{
+    for (int e = 0; e < BOARD_EDGES; e++)
+    {
+        g.addEdge(boardEdge(e).first, boardEdge(e).second);
+    }
+}
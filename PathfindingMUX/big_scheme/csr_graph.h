@@ -0,0 +1,217 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+#include "bitset.h"
+
+using namespace std;
+
+// Compressed sparse row version of Graph.
+// Edges are collected with addEdge() and then frozen into one offsets array and one
+// neighbour array, so a BFS step walks contiguous memory instead of list nodes.
+// Neighbours keep the order in which the edges were added, so the paths found are
+// the same as the ones found by Graph.
+class CSRGraph
+{
+    int numVertices;
+    vector<pair<int, int>> pendingEdges; // Edges added before freeze()
+    vector<int> offsets;                 // Neighbours of v are neighbours[offsets[v] .. offsets[v + 1])
+    vector<int> neighbours;
+    const int *offsetsData;              // offsets and neighbours, or a constant table from the second constructor
+    const int *neighboursData;
+    bool frozen;
+
+    // BFS scratch, allocated once
+    EpochBitset visited; // Cleared per query by bumping its epoch
+    vector<int> parent;
+    vector<int> bfsQueue;
+    PinBitset globalUsedPins; // Global tracking of used pins
+    vector<int> usedPinsLog;  // Pins in the order they were reserved, lets callers see what changed
+
+    void reservePin(int pin)
+    {
+        if (!isSpecialPin(pin) && !globalUsedPins.test(pin))
+        {
+            globalUsedPins.set(pin); // Mark as used globally, excluding special pins
+            usedPinsLog.push_back(pin);
+        }
+    }
+
+public:
+    CSRGraph(int vertices)
+        : numVertices(vertices), offsets(vertices + 1, 0), offsetsData(nullptr), neighboursData(nullptr), frozen(false),
+          visited(vertices), parent(vertices, -1), bfsQueue(vertices), globalUsedPins(vertices) {}
+
+    // Frozen graph over adjacency arrays already in CSR form, such as boardCSR. The arrays are
+    // used in place and must outlive the graph; only the BFS scratch is allocated.
+    CSRGraph(int vertices, const int *csrOffsets, const int *csrNeighbours)
+        : numVertices(vertices), offsetsData(csrOffsets), neighboursData(csrNeighbours), frozen(true),
+          visited(vertices), parent(vertices, -1), bfsQueue(vertices), globalUsedPins(vertices) {}
+
+    void addEdge(int src, int dest)
+    {
+        if (frozen)
+        {
+            return; // The graph can't change after freeze()
+        }
+        pendingEdges.push_back(make_pair(src, dest));
+    }
+
+    // Builds the CSR arrays from the collected edges. Must be called before findPathBFS.
+    void freeze()
+    {
+        if (frozen)
+        {
+            return;
+        }
+
+        // Count the degree of every vertex
+        for (const auto &edge : pendingEdges)
+        {
+            offsets[edge.first + 1]++;
+            offsets[edge.second + 1]++;
+        }
+        for (int v = 0; v < numVertices; v++)
+        {
+            offsets[v + 1] += offsets[v];
+        }
+
+        // Fill in the same order as Graph::addEdge pushes onto its lists
+        neighbours.resize(offsets[numVertices]);
+        vector<int> next(offsets.begin(), offsets.end() - 1);
+        for (const auto &edge : pendingEdges)
+        {
+            neighbours[next[edge.first]++] = edge.second;
+            neighbours[next[edge.second]++] = edge.first;
+        }
+
+        pendingEdges.clear();
+        pendingEdges.shrink_to_fit();
+        offsetsData = offsets.data();
+        neighboursData = neighbours.data();
+        frozen = true;
+    }
+
+    bool isFrozen() const
+    {
+        return frozen;
+    }
+
+    int vertexCount() const
+    {
+        return numVertices;
+    }
+
+    int edgeCount() const
+    {
+        return frozen ? offsetsData[numVertices] / 2 : (int)pendingEdges.size();
+    }
+
+    const int *neighboursBegin(int vertex) const
+    {
+        return neighboursData + offsetsData[vertex];
+    }
+
+    const int *neighboursEnd(int vertex) const
+    {
+        return neighboursData + offsetsData[vertex + 1];
+    }
+
+    bool isSpecialPin(int pin) const
+    {
+        // Assuming MainBreadboard and MCUBreadboard have specific ID ranges based on your setup
+        int mainBreadboardStart = 18 * 24, mainBreadboardEnd = 18 * 24 + 63;
+        int mcuBreadboardStart = 18 * 24 + 64, mcuBreadboardEnd = 18 * 24 + 127;
+
+        return (pin >= mainBreadboardStart && pin <= mainBreadboardEnd) ||
+               (pin >= mcuBreadboardStart && pin <= mcuBreadboardEnd);
+    }
+
+    void clearUsedPins()
+    {
+        globalUsedPins.clear();
+        usedPinsLog.clear();
+    }
+
+    bool isPinUsed(int pin) const
+    {
+        return globalUsedPins.test(pin);
+    }
+
+    // Reserves the pins of a path that was found outside findPathBFS
+    void reservePath(const vector<int> &path)
+    {
+        for (int pin : path)
+        {
+            reservePin(pin);
+        }
+    }
+
+    // Number of pins reserved so far; usedPinAt(i) for i >= an older count are the pins reserved since
+    size_t usedPinsCount() const
+    {
+        return usedPinsLog.size();
+    }
+
+    int usedPinAt(size_t i) const
+    {
+        return usedPinsLog[i];
+    }
+
+    vector<int> findPathBFS(int startVertex, int endVertex)
+    {
+        vector<int> path;
+        if (!frozen)
+        {
+            return path;
+        }
+
+        visited.clear(); // Reset visited status
+        int head = 0, tail = 0;
+
+        visited.set(startVertex);
+        bfsQueue[tail++] = startVertex;
+        bool found = false;
+
+        while (head < tail && !found)
+        {
+            int current = bfsQueue[head++];
+
+            for (const int *it = neighboursBegin(current), *end = neighboursEnd(current); it != end; ++it)
+            {
+                int adjVertex = *it;
+                if (!visited.test(adjVertex) && (!globalUsedPins.test(adjVertex) || isSpecialPin(adjVertex)))
+                {
+                    parent[adjVertex] = current; // Track the path
+                    visited.set(adjVertex);
+                    bfsQueue[tail++] = adjVertex;
+
+                    if (adjVertex == endVertex)
+                    {
+                        found = true;
+                        break; // Stop BFS when endVertex is found
+                    }
+                }
+            }
+        }
+
+        if (!found)
+        {
+            return path; // Empty if no path found
+        }
+
+        // Reconstruct and reserve the path
+        for (int at = endVertex; at != startVertex; at = parent[at])
+        {
+            path.push_back(at);
+            reservePin(at);
+        }
+        path.push_back(startVertex);
+        reservePin(startVertex);
+
+        reverse(path.begin(), path.end()); // Reverse to get the correct order from start to end
+        return path;
+    }
+};
@@ -0,0 +1,314 @@
+#pragma once
+
+#include <vector>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <chrono>
+
+#include "csr_graph.h"
+
+using namespace std;
+
+// Negotiated congestion router (PathFinder style) over a frozen CSRGraph.
+//
+// Every request is a net that needs its own MUX pins; breadboard pins are shared as in findPathBFS.
+// Each iteration rips up and reroutes the nets that sit on an overused pin with a cost of
+// (base + history[v]) * (1 + presentFactor * occupancy[v]), so nets bid for pins instead of the first
+// request taking them for good. The present factor grows every iteration and pins that stay overused
+// get more expensive through their history cost, until a net's cheapest path costs more than dropCost.
+// That net is left unrouted for the iteration and tries again in the next one, so a netlist that
+// doesn't fit still converges, with fewer nets, instead of sharing pins until maxIterations.
+// If negotiation stops with pins still overused, the nets are kept in request order and the dropped
+// ones get one more BFS over the free pins.
+class NegotiatedRouter
+{
+    CSRGraph &graph;
+    int numVertices;
+    vector<int> occupancy;  // Nets currently using each pin
+    vector<double> history; // Accumulated congestion cost per pin
+
+    // Dijkstra scratch
+    vector<double> distance;
+    vector<int> parent;
+
+    double presentFactor;
+
+    double pinCost(int pin) const
+    {
+        if (graph.isSpecialPin(pin))
+        {
+            return baseCost;
+        }
+        return (baseCost + history[pin]) * (1 + presentFactor * occupancy[pin]);
+    }
+
+    void addUsage(const vector<int> &path, int delta)
+    {
+        for (int pin : path)
+        {
+            if (!graph.isSpecialPin(pin))
+            {
+                occupancy[pin] += delta;
+            }
+        }
+    }
+
+    bool isOverused(const vector<int> &path) const
+    {
+        for (int pin : path)
+        {
+            if (!graph.isSpecialPin(pin) && occupancy[pin] > 1)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Cheapest path under the current costs; pins already reserved in the graph are off limits
+    vector<int> cheapestPath(int startVertex, int endVertex)
+    {
+        typedef pair<double, int> QueueEntry;
+        priority_queue<QueueEntry, vector<QueueEntry>, greater<QueueEntry>> pq;
+        fill(distance.begin(), distance.end(), -1);
+
+        distance[startVertex] = 0;
+        parent[startVertex] = -1;
+        pq.push(make_pair(0.0, startVertex));
+
+        while (!pq.empty())
+        {
+            QueueEntry top = pq.top();
+            pq.pop();
+            int current = top.second;
+            if (top.first > distance[current])
+            {
+                continue; // Stale entry
+            }
+            if (current == endVertex)
+            {
+                break;
+            }
+
+            for (const int *it = graph.neighboursBegin(current), *end = graph.neighboursEnd(current); it != end; ++it)
+            {
+                int adjVertex = *it;
+                if (graph.isPinUsed(adjVertex) && !graph.isSpecialPin(adjVertex))
+                {
+                    continue;
+                }
+                double d = top.first + pinCost(adjVertex);
+                if (d >= dropCost)
+                {
+                    continue; // Too congested, the net waits for the next iteration
+                }
+                if (distance[adjVertex] < 0 || d < distance[adjVertex])
+                {
+                    distance[adjVertex] = d;
+                    parent[adjVertex] = current;
+                    pq.push(make_pair(d, adjVertex));
+                }
+            }
+        }
+
+        vector<int> path;
+        if (startVertex == endVertex || distance[endVertex] < 0)
+        {
+            return path;
+        }
+        for (int at = endVertex; at != -1; at = parent[at])
+        {
+            path.push_back(at);
+        }
+        reverse(path.begin(), path.end());
+        return path;
+    }
+
+    // Plain BFS over the pins no kept net has claimed
+    vector<int> freePath(int startVertex, int endVertex, const PinBitset &claimed)
+    {
+        vector<int> path;
+        fill(parent.begin(), parent.end(), -2);
+        vector<int> q;
+        q.push_back(startVertex);
+        parent[startVertex] = -1;
+
+        for (size_t head = 0; head < q.size() && parent[endVertex] == -2; head++)
+        {
+            int current = q[head];
+            for (const int *it = graph.neighboursBegin(current), *end = graph.neighboursEnd(current); it != end; ++it)
+            {
+                int adjVertex = *it;
+                bool blocked = !graph.isSpecialPin(adjVertex) && (claimed.test(adjVertex) || graph.isPinUsed(adjVertex));
+                if (parent[adjVertex] == -2 && !blocked)
+                {
+                    parent[adjVertex] = current;
+                    q.push_back(adjVertex);
+                }
+            }
+        }
+
+        if (startVertex == endVertex || parent[endVertex] == -2)
+        {
+            return path;
+        }
+        for (int at = endVertex; at != -1; at = parent[at])
+        {
+            path.push_back(at);
+        }
+        reverse(path.begin(), path.end());
+        return path;
+    }
+
+public:
+    // Tuning, the defaults follow the usual PathFinder schedule
+    int maxIterations = 50;
+    int stallIterations = 20; // Give up once the overused pin count hasn't improved for this many iterations
+    double baseCost = 1.0;
+    double initialPresentFactor = 0.5;
+    double presentFactorGrowth = 1.5;
+    double historyFactor = 0.3;
+    double dropCost = 100; // Cheapest path cost above which a net stays unrouted for the iteration
+
+    struct Stats
+    {
+        int iterations = 0;      // Negotiation iterations run
+        bool converged = false;  // True if no pin was overused at the end of negotiation
+        int reroutes = 0;        // Total rip-up and reroute operations
+        int dropped = 0;         // Nets left without a path
+        int routed = 0;          // Nets with a path in the final result
+        int fallbackRouted = 0;  // Nets of those that only the final BFS over the free pins routed
+        double totalMicros = 0;
+        vector<double> iterationMicros;
+        vector<int> overusedPins; // Overused pin count after every iteration
+    };
+
+    Stats stats;
+
+    NegotiatedRouter(CSRGraph &g)
+        : graph(g), numVertices(g.vertexCount()), occupancy(numVertices, 0), history(numVertices, 0),
+          distance(numVertices, -1), parent(numVertices, -1), presentFactor(0) {}
+
+    // Routes all requests together and reserves the pins of the final paths in the graph.
+    // paths[i] is empty when request i could not be routed.
+    vector<vector<int>> route(const vector<pair<int, int>> &requests)
+    {
+        auto routeStart = chrono::steady_clock::now();
+        stats = Stats();
+        fill(occupancy.begin(), occupancy.end(), 0);
+        fill(history.begin(), history.end(), 0);
+        presentFactor = initialPresentFactor;
+
+        vector<vector<int>> paths(requests.size());
+        int bestOverused = numVertices + 1;
+        int bestIteration = 0;
+
+        for (int iteration = 0; iteration < maxIterations; iteration++)
+        {
+            auto iterationStart = chrono::steady_clock::now();
+
+            for (size_t r = 0; r < requests.size(); r++)
+            {
+                if (iteration > 0 && !paths[r].empty() && !isOverused(paths[r]))
+                {
+                    continue; // Only nets on a congested pin are ripped up, unrouted ones try again
+                }
+                addUsage(paths[r], -1);
+                paths[r] = cheapestPath(requests[r].first, requests[r].second);
+                addUsage(paths[r], +1);
+                stats.reroutes++;
+            }
+
+            int overused = 0;
+            for (int v = 0; v < numVertices; v++)
+            {
+                if (occupancy[v] > 1)
+                {
+                    overused++;
+                    history[v] += historyFactor * (occupancy[v] - 1);
+                }
+            }
+            presentFactor *= presentFactorGrowth;
+
+            stats.iterations++;
+            stats.overusedPins.push_back(overused);
+            stats.iterationMicros.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - iterationStart).count());
+
+            if (overused == 0)
+            {
+                stats.converged = true;
+                break;
+            }
+            if (overused < bestOverused)
+            {
+                bestOverused = overused;
+                bestIteration = iteration;
+            }
+            else if (iteration - bestIteration >= stallIterations)
+            {
+                break; // The nets don't fit, more iterations won't change that
+            }
+        }
+
+        // Keep the nets that still fit in request order, then give the dropped ones a plain BFS
+        PinBitset claimed(numVertices);
+        vector<size_t> droppedNets;
+        for (size_t r = 0; r < paths.size(); r++)
+        {
+            bool fits = !paths[r].empty();
+            for (int pin : paths[r])
+            {
+                if (!graph.isSpecialPin(pin) && claimed.test(pin))
+                {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits)
+            {
+                for (int pin : paths[r])
+                {
+                    if (!graph.isSpecialPin(pin))
+                    {
+                        claimed.set(pin);
+                    }
+                }
+            }
+            else
+            {
+                paths[r].clear();
+                droppedNets.push_back(r);
+            }
+        }
+        for (size_t r : droppedNets)
+        {
+            paths[r] = freePath(requests[r].first, requests[r].second, claimed);
+            stats.fallbackRouted += !paths[r].empty();
+            for (int pin : paths[r])
+            {
+                if (!graph.isSpecialPin(pin))
+                {
+                    claimed.set(pin);
+                }
+            }
+        }
+
+        for (const auto &path : paths)
+        {
+            if (path.empty())
+            {
+                stats.dropped++;
+            }
+            else
+            {
+                stats.routed++;
+                graph.reservePath(path);
+            }
+        }
+
+        stats.totalMicros = chrono::duration<double, micro>(chrono::steady_clock::now() - routeStart).count();
+        return paths;
+    }
+};
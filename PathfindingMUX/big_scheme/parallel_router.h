@@ -0,0 +1,248 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+#include "bitset.h"
+#include "csr_graph.h"
+
+using namespace std;
+
+// Fixed set of worker threads. run() hands out job indices through a shared atomic counter, so a
+// thread that finishes early keeps taking jobs from the others, and returns once every job is done.
+class ThreadPool
+{
+    vector<thread> workers;
+    mutex lock;
+    condition_variable wake, done;
+    const function<void(int, int)> *job = nullptr; // (threadIndex, jobIndex)
+    int jobCount = 0;
+    atomic<int> nextJob{0};
+    int busyWorkers = 0;
+    unsigned generation = 0;
+    bool stopping = false;
+
+    void workerLoop(int threadIndex)
+    {
+        unsigned seenGeneration = 0;
+        while (true)
+        {
+            {
+                unique_lock<mutex> guard(lock);
+                wake.wait(guard, [&]() { return stopping || generation != seenGeneration; });
+                if (stopping)
+                {
+                    return;
+                }
+                seenGeneration = generation;
+            }
+
+            for (int i = nextJob++; i < jobCount; i = nextJob++)
+            {
+                (*job)(threadIndex, i);
+            }
+
+            unique_lock<mutex> guard(lock);
+            if (--busyWorkers == 0)
+            {
+                done.notify_one();
+            }
+        }
+    }
+
+public:
+    ThreadPool(int threads)
+    {
+        for (int i = 0; i < threads; i++)
+        {
+            workers.push_back(thread(&ThreadPool::workerLoop, this, i));
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            unique_lock<mutex> guard(lock);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    int size() const
+    {
+        return (int)workers.size();
+    }
+
+    void run(int count, const function<void(int, int)> &fn)
+    {
+        unique_lock<mutex> guard(lock);
+        job = &fn;
+        jobCount = count;
+        nextJob = 0;
+        busyWorkers = (int)workers.size();
+        generation++;
+        wake.notify_all();
+        done.wait(guard, [&]() { return busyWorkers == 0; });
+    }
+};
+
+// Routes independent requests on several threads over a frozen CSRGraph.
+//
+// Requests are taken in windows. Every request of a window is searched in parallel against the
+// used pins as they were when the window started, each thread with its own BFS scratch. The paths
+// are then committed in priority order as transactions: a path whose pins are all still free is
+// reserved, a path that collides with one committed before it goes back to the queue and is searched
+// again in the next window. A request with no path against the window's pins has none later either.
+// The result depends only on the seed and the window size, never on thread count or timing.
+class ParallelRouter
+{
+    struct Scratch
+    {
+        EpochBitset visited;
+        vector<int> parent;
+        vector<int> bfsQueue;
+
+        Scratch(int vertices) : visited(vertices), parent(vertices, -1), bfsQueue(vertices) {}
+    };
+
+    CSRGraph &graph;
+    ThreadPool pool;
+    vector<Scratch> scratch; // One per thread
+
+    // Same search as CSRGraph::findPathBFS, without reserving anything
+    vector<int> searchPath(Scratch &s, int startVertex, int endVertex) const
+    {
+        vector<int> path;
+        s.visited.clear();
+        int head = 0, tail = 0;
+        s.visited.set(startVertex);
+        s.bfsQueue[tail++] = startVertex;
+        bool found = false;
+
+        while (head < tail && !found)
+        {
+            int current = s.bfsQueue[head++];
+            for (const int *it = graph.neighboursBegin(current), *end = graph.neighboursEnd(current); it != end; ++it)
+            {
+                int adjVertex = *it;
+                if (!s.visited.test(adjVertex) && (!graph.isPinUsed(adjVertex) || graph.isSpecialPin(adjVertex)))
+                {
+                    s.parent[adjVertex] = current;
+                    s.visited.set(adjVertex);
+                    s.bfsQueue[tail++] = adjVertex;
+                    if (adjVertex == endVertex)
+                    {
+                        found = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (!found)
+        {
+            return path;
+        }
+        for (int at = endVertex; at != startVertex; at = s.parent[at])
+        {
+            path.push_back(at);
+        }
+        path.push_back(startVertex);
+        reverse(path.begin(), path.end());
+        return path;
+    }
+
+    bool tryCommit(const vector<int> &path)
+    {
+        for (int pin : path)
+        {
+            if (!graph.isSpecialPin(pin) && graph.isPinUsed(pin))
+            {
+                return false; // Collision with a path committed earlier in this window
+            }
+        }
+        graph.reservePath(path);
+        return true;
+    }
+
+public:
+    int windowSize = 64; // Requests searched in parallel per window
+    unsigned seed = 0;   // 0 keeps the request order, anything else shuffles the commit priority
+    int searches = 0;    // BFS runs, including retries
+    int retries = 0;     // Paths dropped on commit because of a collision
+
+    ParallelRouter(CSRGraph &g, int threads)
+        : graph(g), pool(max(1, threads)), scratch(max(1, threads), Scratch(g.vertexCount())) {}
+
+    // Routes (start, end) vertex pairs and reserves the pins of every path found.
+    // paths[i] is empty when request i could not be routed.
+    vector<vector<int>> route(const vector<pair<int, int>> &requests)
+    {
+        vector<vector<int>> paths(requests.size());
+        searches = 0;
+        retries = 0;
+
+        vector<int> order(requests.size());
+        iota(order.begin(), order.end(), 0);
+        if (seed != 0)
+        {
+            mt19937 rng(seed);
+            shuffle(order.begin(), order.end(), rng);
+        }
+
+        vector<int> pending(order.rbegin(), order.rend()); // Back of the vector is the highest priority
+        vector<int> window;
+        vector<vector<int>> found;
+
+        while (!pending.empty())
+        {
+            window.clear();
+            while (!pending.empty() && (int)window.size() < windowSize)
+            {
+                window.push_back(pending.back());
+                pending.pop_back();
+            }
+
+            found.assign(window.size(), vector<int>());
+            function<void(int, int)> search = [&](int threadIndex, int i) {
+                found[i] = searchPath(scratch[threadIndex], requests[window[i]].first, requests[window[i]].second);
+            };
+            pool.run((int)window.size(), search);
+            searches += (int)window.size();
+
+            // Commit in priority order; collisions go back in front of the queue, keeping their order
+            vector<int> collided;
+            for (size_t i = 0; i < window.size(); i++)
+            {
+                if (found[i].empty())
+                {
+                    continue; // No path
+                }
+                if (tryCommit(found[i]))
+                {
+                    paths[window[i]] = found[i];
+                }
+                else
+                {
+                    collided.push_back(window[i]);
+                    retries++;
+                }
+            }
+            pending.insert(pending.end(), collided.rbegin(), collided.rend());
+        }
+
+        return paths;
+    }
+};
@@ -0,0 +1,351 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <list>
+#include <queue>
+#include <unordered_set>
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+
+using namespace std;
+
+enum DeviceType
+{
+    DEVICE,
+    MULTIPLEXER,
+    BREADBOARD
+};
+
+// BREADBOARD OR MUX
+class Device {
+public:
+    int num;
+    DeviceType type; // Lets callers dispatch without dynamic_cast
+
+    Device(int n, DeviceType t) : num(n), type(t) {}
+
+    virtual void printConnections() const = 0;
+};
+
+class ConnectionNode{
+public:
+    Device* device;
+    int index;
+    char connectionType;
+
+    ConnectionNode(Device* d, int i, char type);
+
+    void print() const;
+};
+
+class Multiplexer : public Device {
+public:
+    ConnectionNode* x[16];
+    ConnectionNode* y[8];
+
+    Multiplexer(int n);
+
+    void printConnections() const override;
+};
+
+class Breadboard : public Device {
+public:
+    ConnectionNode* pin[64];
+
+    Breadboard(int n);
+
+    void printConnections() const override;
+};
+
+ConnectionNode::ConnectionNode(Device* d, int i, char type) : device(d), index(i), connectionType(type) {}
+
+void ConnectionNode::print() const {
+    if (device->type == MULTIPLEXER) {
+        cout << "MUX_" << device->num << "." << connectionType << "[" << index << "]";
+    } else if (device->type == BREADBOARD) {
+        cout << "Breadboard_" << device->num << ".pin[" << index << "]";
+    }
+}
+
+Multiplexer::Multiplexer(int n) : Device(n, MULTIPLEXER) {
+    for (auto& xi : x) xi = nullptr;
+    for (auto& yi : y) yi = nullptr;
+}
+
+Breadboard::Breadboard(int n) : Device(n, BREADBOARD) {
+    for (auto& pin : pin) pin = nullptr;
+}
+
+void Multiplexer::printConnections() const {
+    for (int i = 0; i < 16; ++i) {
+        if (x[i]) {
+            cout << "MUX_" << num << ".x[" << i << "] -> ";
+            x[i]->print();
+            cout << endl;
+        }
+    }
+    for (int i = 0; i < 8; ++i) {
+        if (y[i]) {
+            cout << "MUX_" << num << ".y[" << i << "] -> ";
+            y[i]->print();
+            cout << endl;
+        }
+    }
+}
+
+void Breadboard::printConnections() const {
+    for (int i = 0; i < 64; ++i) {
+        if (pin[i]) {
+            cout << "Breadboard_" << num << ".pin[" << i << "] -> ";
+            pin[i]->print();  // This will print either MUX or Breadboard connection information
+            cout << endl;
+        }
+    }
+}
+
+// The connection node behind a pin, picked by the device tag
+ConnectionNode *connectionNodeAt(Device &device, char type, int index) {
+    if (device.type == MULTIPLEXER) {
+        Multiplexer &mux = static_cast<Multiplexer &>(device);
+        return (type == 'x') ? mux.x[index] : mux.y[index];
+    }
+    if (device.type == BREADBOARD) {
+        return static_cast<Breadboard &>(device).pin[index];
+    }
+    return nullptr;
+}
+
+// check if there is a bidirectional connection between two devices
+bool checkBidirectionalConnection(Device& device1, char type1, int index1, Device& device2, char type2, int index2) {
+    // Breadboards are only wired to MUXes
+    if (device1.type == BREADBOARD && device2.type == BREADBOARD) {
+        return false;
+    }
+
+    ConnectionNode* node1 = connectionNodeAt(device1, type1, index1);
+    ConnectionNode* node2 = connectionNodeAt(device2, type2, index2);
+
+    return node1 && node2 && node1->device == &device2 && node2->device == &device1 && node1->index == index2 && node2->index == index1;
+}
+
+class Graph
+{
+    int numVertices;
+    list<int> *adjLists;
+    bool *visited;
+    unordered_set<int> globalUsedPins; // Global tracking of used pins
+
+public:
+    Graph(int vertices) : numVertices(vertices), adjLists(new list<int>[vertices]), visited(new bool[vertices]()) {}
+
+    ~Graph()
+    {
+        delete[] adjLists;
+        delete[] visited;
+    }
+
+    void addEdge(int src, int dest)
+    {
+        adjLists[src].push_back(dest);
+        adjLists[dest].push_back(src);
+    }
+
+    bool isSpecialPin(int pin)
+    {
+        // Assuming MainBreadboard and MCUBreadboard have specific ID ranges based on your setup
+        int mainBreadboardStart = 18 * 24, mainBreadboardEnd = 18 * 24 + 63;     // Adjust these based on actual ranges
+        int mcuBreadboardStart = 18 * 24 + 64, mcuBreadboardEnd = 18 * 24 + 127; // Adjust these based on actual ranges
+
+        return (pin >= mainBreadboardStart && pin <= mainBreadboardEnd) ||
+               (pin >= mcuBreadboardStart && pin <= mcuBreadboardEnd);
+    }
+
+    void clearUsedPins()
+    {
+        globalUsedPins.clear();
+    }
+
+    vector<int> findPathBFS(int startVertex, int endVertex)
+    {
+        fill(visited, visited + numVertices, false); // Reset visited status
+        queue<int> q;
+        unordered_map<int, int> parent; // To store the path
+        vector<int> path;
+
+        visited[startVertex] = true;
+        q.push(startVertex);
+        bool found = false;
+
+        while (!q.empty() && !found)
+        {
+            int current = q.front();
+            q.pop();
+
+            for (int adjVertex : adjLists[current])
+            {
+                if (!visited[adjVertex] && (globalUsedPins.find(adjVertex) == globalUsedPins.end() || isSpecialPin(adjVertex)))
+                {
+                    parent[adjVertex] = current; // Track the path
+                    visited[adjVertex] = true;
+                    q.push(adjVertex);
+
+                    if (adjVertex == endVertex)
+                    {
+                        found = true;
+                        break; // Stop BFS when endVertex is found
+                    }
+                }
+            }
+        }
+
+        if (!found)
+        {
+            cout << "No path found between " << startVertex << " and " << endVertex << endl;
+            return path; // Empty if no path found
+        }
+
+        // Reconstruct and reserve the path
+        for (int at = endVertex; at != startVertex; at = parent[at])
+        {
+            path.push_back(at);
+            if (!isSpecialPin(at))
+            {
+                globalUsedPins.insert(at); // Mark as used globally, excluding special pins
+            }
+        }
+        path.push_back(startVertex); // Add start vertex at the end
+        if (!isSpecialPin(startVertex))
+        {
+            globalUsedPins.insert(startVertex); // Mark as used globally, excluding special pins
+        }
+
+        reverse(path.begin(), path.end()); // Reverse to get the correct order from start to end
+        return path;
+    }
+};
+
+
+// Graph vertex numbering: MUX n has x[0..15] at n * 24 and y[0..7] right after,
+// the breadboards come after all 18 MUXes. Usable in constant expressions.
+constexpr int muxX(int mux, int x) { return mux * 24 + x; }
+constexpr int muxY(int mux, int y) { return mux * 24 + 16 + y; }
+constexpr int mainPin(int pin) { return 18 * 24 + pin; }
+constexpr int mcuPin(int pin) { return 18 * 24 + 64 + pin; }
+
+int getGraphVertexID(const Device *device, char type, int pinIndex)
+{
+    int deviceId = device->num;
+    if (device->type == MULTIPLEXER)
+    {
+        return type == 'x' ? muxX(deviceId, pinIndex) : muxY(deviceId, pinIndex);
+    }
+    else if (device->type == BREADBOARD)
+    {
+        if (deviceId == 19) // Main breadboard
+        {
+            return mainPin(pinIndex);
+        }
+
+        if (deviceId == 20) // MCU breadboard
+        {
+            return mcuPin(pinIndex);
+        }
+    }
+    return -1; // Error case
+}
+
+// Longest vertex label (" -> MainBreadboard 64") plus the terminating NUL, with room to spare
+const int VERTEX_LABEL_SIZE = 24;
+
+// Copies text to out and returns the position after it
+char *appendLabelText(char *out, const char *text)
+{
+    while (*text)
+    {
+        *out++ = *text++;
+    }
+    return out;
+}
+
+// Writes the decimal digits of a non-negative value to out and returns the position after them
+char *appendLabelNumber(char *out, int value)
+{
+    char digits[10];
+    int n = 0;
+    do
+    {
+        digits[n++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+    while (n > 0)
+    {
+        *out++ = digits[--n];
+    }
+    return out;
+}
+
+// Writes the label of a vertex (" -> MUX3 x5", " -> MainBreadboard 12") into buffer, which must hold
+// VERTEX_LABEL_SIZE chars. The label is NUL terminated, the return value is its length.
+// Breadboard pins are shown from 1. No allocation and no output, so it can run in tight loops.
+int formatVertexLabel(char *buffer, int vertexID)
+{
+    char *out = buffer;
+    if (vertexID < mainPin(0))
+    {
+        int pinIndex = vertexID % 24;
+        out = appendLabelText(out, " -> MUX");
+        out = appendLabelNumber(out, vertexID / 24 + 1);
+        *out++ = ' ';
+        *out++ = pinIndex < 16 ? 'x' : 'y';
+        out = appendLabelNumber(out, pinIndex < 16 ? pinIndex : pinIndex - 16);
+    }
+    else if (vertexID < mcuPin(0))
+    {
+        out = appendLabelText(out, " -> MainBreadboard ");
+        out = appendLabelNumber(out, vertexID - mainPin(0) + 1);
+    }
+    else
+    {
+        out = appendLabelText(out, " -> MCUBreadboard ");
+        out = appendLabelNumber(out, vertexID - mcuPin(0) + 1);
+    }
+    *out = '\0';
+    return (int)(out - buffer);
+}
+
+// Label of a vertex as a string, see formatVertexLabel
+string printDeviceSpecifications(int vertexID)
+{
+    char label[VERTEX_LABEL_SIZE];
+    return string(label, formatVertexLabel(label, vertexID));
+}
+
+struct PathRequest
+{
+    Device *startDevice;
+    char startType;
+    int startPin;
+    Device *endDevice;
+    char endType;
+    int endPin;
+
+    PathRequest(Device *startDevice, char startType, int startPin, Device *endDevice, char endType, int endPin)
+        : startDevice(startDevice), startType(startType), startPin(startPin), endDevice(endDevice), endType(endType), endPin(endPin) {}
+};
+
+// (start, end) graph vertices of every request, the form the routers work on
+vector<pair<int, int>> requestVertices(const vector<PathRequest> &requests)
+{
+    vector<pair<int, int>> vertexPairs;
+    vertexPairs.reserve(requests.size());
+    for (const auto &request : requests)
+    {
+        vertexPairs.push_back(make_pair(getGraphVertexID(request.startDevice, request.startType, request.startPin),
+                                        getGraphVertexID(request.endDevice, request.endType, request.endPin)));
+    }
+    return vertexPairs;
+}
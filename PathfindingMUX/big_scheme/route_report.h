@@ -0,0 +1,198 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "pathfinding.h"
+
+using namespace std;
+
+// Collects the routing results of a sweep in memory and writes every file once in flush().
+// The files are opened once, in the constructor, and the buffers keep their capacity between
+// flushes, so a sweep costs one write per file instead of an open/close per request.
+//
+// TEXT   found_paths.txt / not_found_paths.txt (appended), same text the sweep always wrote,
+//        echoed to the console on flush
+// CSV    paths.csv: start,end,found,path with the path as space separated vertex IDs
+// BINARY paths.bin: per request uint16 start, end, path length, then the path vertices (host byte order)
+class RouteReport
+{
+public:
+    enum Format
+    {
+        TEXT,
+        CSV,
+        BINARY
+    };
+
+private:
+    Format format;
+    bool echo;
+    ofstream foundFile;
+    ofstream notFoundFile; // TEXT only
+    string foundBuffer;
+    string notFoundBuffer;
+
+    static void appendNumber(string &out, int value)
+    {
+        char digits[12];
+        int n = 0;
+        unsigned magnitude = value < 0 ? 0u - (unsigned)value : (unsigned)value;
+        do
+        {
+            digits[n++] = (char)('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (value < 0)
+        {
+            out += '-';
+        }
+        while (n > 0)
+        {
+            out += digits[--n];
+        }
+    }
+
+    static void appendLabel(string &out, int vertex)
+    {
+        char label[VERTEX_LABEL_SIZE];
+        out.append(label, formatVertexLabel(label, vertex));
+    }
+
+    static void appendUint16(string &out, int value)
+    {
+        uint16_t v = (uint16_t)value;
+        out.append((const char *)&v, sizeof(v));
+    }
+
+public:
+    int found = 0;
+    int notFound = 0;
+
+    RouteReport(Format f = TEXT, bool echoToConsole = true) : format(f), echo(echoToConsole && f == TEXT)
+    {
+        if (format == TEXT)
+        {
+            foundFile.open("found_paths.txt", ios::app);
+            notFoundFile.open("not_found_paths.txt", ios::app);
+        }
+        else if (format == CSV)
+        {
+            foundFile.open("paths.csv", ios::trunc);
+            foundBuffer += "start,end,found,path\n";
+        }
+        else
+        {
+            foundFile.open("paths.bin", ios::trunc | ios::binary);
+        }
+    }
+
+    ~RouteReport()
+    {
+        flush();
+    }
+
+    RouteReport(const RouteReport &) = delete;
+    RouteReport &operator=(const RouteReport &) = delete;
+
+    bool isOpen() const
+    {
+        return foundFile.is_open() && (format != TEXT || notFoundFile.is_open());
+    }
+
+    // Records one routing result. Returns 1 for a found path, 0 for an empty one and -1 if the
+    // output files couldn't be opened.
+    int add(int startVertex, int endVertex, const vector<int> &path)
+    {
+        if (!isOpen())
+        {
+            return -1;
+        }
+        path.empty() ? notFound++ : found++;
+
+        if (format == CSV)
+        {
+            appendNumber(foundBuffer, startVertex);
+            foundBuffer += ',';
+            appendNumber(foundBuffer, endVertex);
+            foundBuffer += path.empty() ? ",0," : ",1,";
+            for (size_t i = 0; i < path.size(); i++)
+            {
+                if (i > 0)
+                {
+                    foundBuffer += ' ';
+                }
+                appendNumber(foundBuffer, path[i]);
+            }
+            foundBuffer += '\n';
+        }
+        else if (format == BINARY)
+        {
+            appendUint16(foundBuffer, startVertex);
+            appendUint16(foundBuffer, endVertex);
+            appendUint16(foundBuffer, (int)path.size());
+            for (int vertex : path)
+            {
+                appendUint16(foundBuffer, vertex);
+            }
+        }
+        else if (!path.empty())
+        {
+            foundBuffer += "Path from ";
+            appendLabel(foundBuffer, startVertex);
+            foundBuffer += " to ";
+            appendLabel(foundBuffer, endVertex);
+            foundBuffer += " is: \n";
+            for (int vertex : path)
+            {
+                appendLabel(foundBuffer, vertex);
+            }
+            foundBuffer += "\n\n";
+        }
+        else
+        {
+            notFoundBuffer += "No path found from ";
+            appendLabel(notFoundBuffer, startVertex);
+            notFoundBuffer += " to ";
+            appendLabel(notFoundBuffer, endVertex);
+            notFoundBuffer += ".\n\n";
+        }
+        return path.empty() ? 0 : 1;
+    }
+
+    // Writes everything recorded since the last flush, one write per file
+    void flush()
+    {
+        if (!foundBuffer.empty())
+        {
+            foundFile.write(foundBuffer.data(), foundBuffer.size());
+            foundFile.flush();
+        }
+        if (!notFoundBuffer.empty())
+        {
+            notFoundFile.write(notFoundBuffer.data(), notFoundBuffer.size());
+            notFoundFile.flush();
+        }
+        if (echo)
+        {
+            cout.write(foundBuffer.data(), foundBuffer.size());
+            cout.write(notFoundBuffer.data(), notFoundBuffer.size());
+            cout.flush();
+        }
+        foundBuffer.clear(); // clear() keeps the capacity for the next sweep
+        notFoundBuffer.clear();
+    }
+};
+
+template <typename GraphType>
+int findAndPrintPath(GraphType &graph, const PathRequest &request, RouteReport &report)
+{
+    int startVertex = getGraphVertexID(request.startDevice, request.startType, request.startPin);
+    int endVertex = getGraphVertexID(request.endDevice, request.endType, request.endPin);
+
+    vector<int> path = graph.findPathBFS(startVertex, endVertex);
+    return report.add(startVertex, endVertex, path);
+}
@@ -0,0 +1,184 @@
+// Generates C_U_Mini/route_table.h: every candidate MUX route for every MainBreadboard x MCUBreadboard
+// pin pair of the mini board, so the firmware can pick a route with a table lookup instead of a BFS.
+//
+// Build and run from this directory:
+//   g++ -O2 -std=c++14 generate_route_table.cpp -o generate_route_table
+//   ./generate_route_table > ../../C_U_Mini/route_table.h
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include "../../C_U_Mini/mini_board.h"
+
+using namespace std;
+
+// Vertex numbering and wiring come from C_U_Mini/mini_board.h, as in the firmware
+const int NUM_MUXES = 2;
+const int MAIN_PINS = 24;
+const int MCU_PINS = 8;
+const int NUM_VERTICES = MINI_VERTICES;
+
+bool isMuxPin(int v) { return v < NUM_MUXES * 24; }
+
+// One closed crosspoint, packed as chip(1) | X(4) | Y(3), the same byte the firmware decodes
+struct Switch
+{
+    int chip, x, y;
+    int packed() const { return (chip << 7) | (x << 3) | y; }
+};
+
+vector<int> adjacency[NUM_VERTICES];
+const int MAX_SWITCHES = 4; // Search limit, the mini board never needs more than 2
+
+void addEdge(int a, int b)
+{
+    adjacency[a].push_back(b);
+    adjacency[b].push_back(a);
+}
+
+void buildMiniBoard()
+{
+    // Every X to Y connection inside a MUX
+    for (int m = 0; m < NUM_MUXES; m++)
+    {
+        for (int x = 0; x < 16; x++)
+        {
+            for (int y = 0; y < 8; y++)
+            {
+                addEdge(muxX(m, x), muxY(m, y));
+            }
+        }
+    }
+
+    for (const auto &wire : miniBoardWires)
+    {
+        addEdge(wire[0], wire[1]);
+    }
+}
+
+bool isSwitchStep(int a, int b)
+{
+    return isMuxPin(a) && isMuxPin(b) && a / 24 == b / 24;
+}
+
+// Depth first search for every simple path from start to target that only passes through MUX pins.
+// Inside a MUX a step X -> Y (or Y -> X) is one switch; steps between MUXes are board wires.
+// Two switches in a row on the same MUX would tie a third pin into the net, so a switch is always
+// followed by a wire.
+void collectRoutes(int current, int target, vector<int> &path, vector<bool> &onPath, vector<vector<int>> &routes)
+{
+    bool lastWasSwitch = path.size() >= 2 && isSwitchStep(path[path.size() - 2], current);
+    for (int next : adjacency[current])
+    {
+        if (onPath[next] || (lastWasSwitch && isSwitchStep(current, next)))
+        {
+            continue;
+        }
+        if (next == target)
+        {
+            path.push_back(next);
+            routes.push_back(path);
+            path.pop_back();
+            continue;
+        }
+        if (!isMuxPin(next) || (int)path.size() >= 2 * MAX_SWITCHES + 1)
+        {
+            continue;
+        }
+        onPath[next] = true;
+        path.push_back(next);
+        collectRoutes(next, target, path, onPath, routes);
+        path.pop_back();
+        onPath[next] = false;
+    }
+}
+
+vector<Switch> toSwitches(const vector<int> &path)
+{
+    vector<Switch> switches;
+    for (size_t i = 1; i + 1 < path.size(); i++)
+    {
+        int a = path[i], b = path[i + 1];
+        if (isSwitchStep(a, b))
+        {
+            int x = (a % 24 < 16) ? a % 24 : b % 24;
+            int y = (a % 24 < 16) ? b % 24 - 16 : a % 24 - 16;
+            switches.push_back(Switch{a / 24, x, y});
+        }
+    }
+    return switches;
+}
+
+int main()
+{
+    buildMiniBoard();
+
+    vector<int> offsets;
+    vector<int> bytes;
+    int maxSwitches = 0, maxRoutes = 0, totalRoutes = 0;
+
+    for (int m = 0; m < MAIN_PINS; m++)
+    {
+        for (int c = 0; c < MCU_PINS; c++)
+        {
+            vector<vector<int>> routes;
+            vector<int> path(1, mainPin(m));
+            vector<bool> onPath(NUM_VERTICES, false);
+            onPath[mainPin(m)] = true;
+            collectRoutes(mainPin(m), mcuPin(c), path, onPath, routes);
+
+            // Fewest switches first, the firmware takes the first route whose pins are free
+            stable_sort(routes.begin(), routes.end(), [](const vector<int> &a, const vector<int> &b) { return a.size() < b.size(); });
+
+            offsets.push_back((int)bytes.size());
+            for (const auto &route : routes)
+            {
+                vector<Switch> switches = toSwitches(route);
+                bytes.push_back((int)switches.size());
+                for (const Switch &s : switches)
+                {
+                    bytes.push_back(s.packed());
+                }
+                maxSwitches = max(maxSwitches, (int)switches.size());
+            }
+            maxRoutes = max(maxRoutes, (int)routes.size());
+            totalRoutes += (int)routes.size();
+        }
+    }
+    offsets.push_back((int)bytes.size());
+
+    printf("// Generated by PathfindingMUX/mini_scheme/generate_route_table.cpp, do not edit by hand.\n");
+    printf("// %d routes for %d MainBreadboard x %d MCUBreadboard pin pairs, %d bytes of routes.\n",
+           totalRoutes, MAIN_PINS, MCU_PINS, (int)bytes.size());
+    printf("#pragma once\n\n");
+    printf("#include <avr/pgmspace.h>\n\n");
+    printf("#define ROUTE_TABLE_MAIN_PINS %d\n", MAIN_PINS);
+    printf("#define ROUTE_TABLE_MCU_PINS %d\n", MCU_PINS);
+    printf("#define ROUTE_MAX_SWITCHES %d\n", maxSwitches);
+    printf("#define ROUTE_MAX_CANDIDATES %d\n\n", maxRoutes);
+    printf("// Routes of pair (main, mcu) are routeTableRoutes[routeTableOffsets[main * %d + mcu] .. routeTableOffsets[main * %d + mcu + 1]).\n", MCU_PINS, MCU_PINS);
+    printf("// Every route is a switch count followed by that many switches packed as MUX(1) | X(4) | Y(3).\n");
+    printf("const uint16_t routeTableOffsets[%d] PROGMEM = {", (int)offsets.size());
+    for (size_t i = 0; i < offsets.size(); i++)
+    {
+        printf("%s%d", i % 16 == 0 ? "\n    " : " ", offsets[i]);
+        if (i + 1 < offsets.size())
+        {
+            printf(",");
+        }
+    }
+    printf("\n};\n\n");
+    printf("const uint8_t routeTableRoutes[%d] PROGMEM = {", (int)bytes.size());
+    for (size_t i = 0; i < bytes.size(); i++)
+    {
+        printf("%s0x%02X", i % 16 == 0 ? "\n    " : " ", bytes[i]);
+        if (i + 1 < bytes.size())
+        {
+            printf(",");
+        }
+    }
+    printf("\n};\n");
+
+    fprintf(stderr, "%d pairs, %d routes, %d route bytes, %d offset bytes, max %d switches, max %d candidates per pair\n",
+            MAIN_PINS * MCU_PINS, totalRoutes, (int)bytes.size(), (int)offsets.size() * 2, maxSwitches, maxRoutes);
+    return 0;
+}
@@ -1,7 +1,7 @@
 import tkinter as tk
 from calculateConnections import *
-import serial
-import time
+from switch_frame import ops_from_text
+from switch_link import SwitchLink
 import openai
 from dotenv import load_dotenv
 import os
@@ -53,27 +53,17 @@ class Breadboard(tk.Tk):
     
     def initialize_serial(self):
         try:
-            self.serial_conn = serial.Serial(self.serial_port, self.baud_rate, timeout=1)
-            time.sleep(2)  # give the connection a second to settle
-            print("Serial Connection Established.")
-            if self.wait_for_arduino():
-                print("Arduino is ready.")
+            # Waits for the Arduino to be ready, then moves to the fastest baud rate that works
+            self.serial_conn = SwitchLink(self.serial_port, self.baud_rate)
+            print(f"Arduino is ready at {self.serial_conn.port.baudrate} baud.")
         except Exception as e:
             print(f"Failed to connect to Arduino via serial: {e}")
 
-    def wait_for_arduino(self):
-        # Wait for the Arduino to send 'Ready'
-        while True:
-            if self.serial_conn.in_waiting > 0:
-                line = self.serial_conn.readline().decode().strip()
-                if line == "Ready":
-                    return True
-            time.sleep(0.1)
-
     def write_to_serial(self, message):
+        # The text commands go out as binary frames, one batch and one ACK per frame
         if self.serial_conn:
             try:
-                self.serial_conn.write(bytes(message, 'utf-8'))
+                self.serial_conn.send_ops(ops_from_text(message))
                 print(f"Sent to Arduino: {message}")
             except Exception as e:
                 print(f"Failed to send message: {e}")
@@ -1,22 +1,16 @@
-import serial
-import time
+from switch_frame import ops_from_text
+from switch_link import SwitchLink
 
-ser = serial.Serial('COM3', 9600) # Open serial port
-time.sleep(2) # Wait for Arduino to initialize
+# Waits for the Arduino to be ready and negotiates the baud rate, no fixed sleep
+link = SwitchLink('COM3')
+print(f"Arduino is ready at {link.port.baudrate} baud, {link.credits} bytes of credits.")
 
-# Wait for Arduino to signal that it's ready
-while True:
-    response = ser.readline().decode().strip()
-    if response == "Ready":
-        print("Arduino is ready.")
-        break
+# Send command to Arduino, answered with one ACK
+link.send_ops(ops_from_text('1000;y5;x10;true;MainBreadboard 15;MCUBreadboard 1'))
+print("Command acknowledged by Arduino")
 
-# Send command to Arduino
-ser.write(b'1000;y5;x10;true;MainBreadboard 15;MCUBreadboard 1')
-response = ser.readline().decode().strip() # Read the response
-print("Response from Arduino:", response)
-response = ser.readline().decode().strip() # Read the response
-print("Response from Arduino:", response)
+# Read the timing counters back, with the LED refresh cost and the bytes lost
+for name, value in link.stats().items():
+    print(f"{name}: {value}")
 
-
-ser.close() # Close the serial port
+link.close() # Close the serial port
@@ -0,0 +1,83 @@
+"""Binary frames for the TuesFestDemo firmware, see TuesFestDemo/SwitchFrame.h.
+
+A frame is SYNC, count, count ops of 2 bytes and a CRC-8 of count and the ops.
+The firmware runs each frame as one batch and answers it with a single ACK or NAK.
+"""
+
+SYNC = 0xA5
+ACK = 0x06
+NAK = 0x15
+MAX_OPS = 32
+
+OP_SWITCH = 0
+OP_LED = 1
+OP_CLEAR = 2
+
+BOARD_MCU = 0
+BOARD_MAIN = 1
+
+BOARDS = {"MCUBreadboard": BOARD_MCU, "MainBreadboard": BOARD_MAIN}
+
+
+def crc8(data, crc=0):
+    # polynomial 0x07, as switchFrameCrc in the firmware
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+def switch_op(chip, x, y, on):
+    if not (0 <= chip <= 15 and 0 <= x <= 15 and 0 <= y <= 7):
+        raise ValueError(f"switch out of range: chip {chip}, x {x}, y {y}")
+    return bytes([OP_SWITCH << 5 | int(on) << 4 | chip, y << 4 | x])
+
+
+def led_op(board, index, on):
+    return bytes([OP_LED << 5 | int(on) << 4 | board, index])
+
+
+def clear_op():
+    return bytes([OP_CLEAR << 5, 0])
+
+
+def ops_from_text(message):
+    """Ops of text commands as main.py builds them, one per line:
+    "1000;y5;x10;true;MainBreadboard 15;MCUBreadboard 1" or "Clear"."""
+    ops = []
+    for line in message.splitlines():
+        tokens = [token.strip() for token in line.split(";") if token.strip()]
+        if not tokens:
+            continue
+        if tokens == ["Clear"]:
+            ops.append(clear_op())
+            continue
+
+        chip = int(tokens[0], 2)  # "1000" is chip address 8
+        x = y = None
+        on = False
+        leds = []
+        for token in tokens[1:]:
+            if token[0] in "xX":
+                x = int(token[1:])
+            elif token[0] in "yY":
+                y = int(token[1:])
+            elif token in ("true", "false"):
+                on = token == "true"
+            else:
+                board, index = token.split(" ")
+                leds.append((BOARDS[board], int(index)))
+        ops.append(switch_op(chip, x, y, on))
+        ops += [led_op(board, index, on) for board, index in leds]
+    return ops
+
+
+def encode_frames(ops, max_ops=MAX_OPS):
+    """Frames of at most max_ops ops each, in order."""
+    frames = []
+    for start in range(0, len(ops), max_ops):
+        chunk = ops[start:start + max_ops]
+        body = bytes([len(chunk)]) + b"".join(chunk)
+        frames.append(bytes([SYNC]) + body + bytes([crc8(body)]))
+    return frames
@@ -0,0 +1,144 @@
+"""Serial link to the TuesFestDemo firmware: startup handshake, baud negotiation and
+credit flow control for the frames of switch_frame.py."""
+
+import time
+from collections import deque
+
+import serial
+
+from switch_frame import ACK, NAK, MAX_OPS, encode_frames
+
+# Tried fastest first, all exact or within 2.1% on a 16 MHz AVR
+BAUD_RATES = (1000000, 500000, 115200)
+
+# Opening the port pulls DTR and resets the board. Optiboot then listens for an upload for about
+# a second before it starts the sketch, so nothing is pinged until this much time has passed.
+BOOT_WAIT = 2.0
+
+# Frame replies the firmware holds back while its LEDs wait to be shown (HELD_REPLIES in
+# TuesFestDemo.ino). With more frames than that on the way it has to show them, with interrupts
+# off, while bytes of the next frames are still arriving.
+HELD_REPLIES = 16
+
+
+class SwitchLink:
+    def __init__(self, port, baud_rate=9600, rates=BAUD_RATES, timeout=1):
+        self.port = serial.Serial(port, baud_rate, timeout=timeout)
+        self.credits = 0
+        self.sent = 0  # bytes since the last Ping, as the firmware's serialBytes
+        self.wait_ready()
+        self.negotiate(rates)
+
+    def write(self, data):
+        self.port.write(data)
+        self.sent += len(data)
+
+    def write_line(self, line):
+        self.write(bytes(line + "\n", "utf-8"))
+
+    def read_line(self):
+        # "" once the timeout passes without a line
+        return self.port.readline().decode(errors="ignore").strip()
+
+    def ping(self):
+        # True when the firmware answers at the current rate, which also tells the credits
+        self.write_line("Ping")
+        while True:
+            line = self.read_line()
+            if not line:
+                return False
+            if line.startswith("Credits "):
+                self.credits = int(line.split(" ")[1])
+                self.sent = 0
+                return True
+
+    def wait_ready(self, attempts=5):
+        # Boards that reset on open print "Ready" once setup() is done; listen for it for BOOT_WAIT
+        # so the first Ping doesn't land in the bootloader. A board that did not reset stays quiet
+        # and is pinged after that.
+        deadline = time.monotonic() + BOOT_WAIT
+        while time.monotonic() < deadline:
+            if self.read_line() == "Ready":
+                break
+        for _ in range(attempts):
+            if self.ping():
+                return
+        raise TimeoutError("no answer from Arduino")
+
+    def negotiate(self, rates):
+        # Moves to the fastest rate both ends get a Ping through at. The firmware goes back to
+        # the old rate by itself when the Ping is lost, which takes less than the read timeout.
+        for rate in rates:
+            old = self.port.baudrate
+            if rate <= old:
+                continue
+            self.write_line(f"Baud {rate}")
+            if self.read_line() != f"Baud {rate}":
+                continue
+            self.port.baudrate = rate
+            if self.ping():
+                return rate
+            self.port.baudrate = old
+            self.port.reset_input_buffer()
+        return self.port.baudrate
+
+    def read_reply(self):
+        while True:
+            reply = self.port.read(1)
+            if not reply:
+                raise TimeoutError("no ACK from Arduino")
+            if reply[0] in (ACK, NAK):
+                return reply[0]
+            # anything else is text output, skip it
+
+    def send_ops(self, ops, retries=3):
+        # Frames go out back to back as long as the unacknowledged ones fit in the credits and
+        # the firmware's held replies. When a frame is refused, the ones sent after it may already
+        # have run, so sending stops until all their replies are in. Then the refused frame and
+        # every frame after it go out again in their original order, so a retried Clear can't
+        # wipe what a later frame connected.
+        max_ops = max(1, min(MAX_OPS, (self.credits - 3) // 2))
+        frames = deque(encode_frames(ops, max_ops))
+        in_flight = deque()
+        used = 0
+        refused = 0
+        while frames or in_flight:
+            while frames and (not in_flight or (used + len(frames[0]) <= self.credits
+                                                and len(in_flight) < HELD_REPLIES)):
+                frame = frames.popleft()
+                self.write(frame)
+                in_flight.append(frame)
+                used += len(frame)
+
+            frame = in_flight.popleft()
+            used -= len(frame)
+            if self.read_reply() == ACK:
+                refused = 0
+                continue
+            resend = [frame]
+            while in_flight:
+                self.read_reply()
+                resend.append(in_flight.popleft())
+            used = 0
+            refused += 1
+            if refused > retries:
+                raise IOError("frame refused by Arduino")
+            frames.extendleft(reversed(resend))
+
+    def stats(self):
+        """The firmware's "Stats" counters by name, plus droppedBytes: what it lost of the bytes sent."""
+        self.write_line("Stats")
+        stats = {}
+        while True:
+            line = self.read_line()
+            if not line:
+                break
+            name, value = line.split(" ")
+            stats[name] = int(value)
+            if name == "badFrames":
+                break  # the last one
+        stats["droppedBytes"] = self.sent - stats.get("serialBytes", 0)
+        return stats
+
+    def close(self):
+        self.port.close()
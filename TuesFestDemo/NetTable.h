@@ -0,0 +1,165 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Active nets and the colour each pin shows. A net is the set of pins one connection joins, as
+// the host adds and removes them; a pin can be in several nets and shows the colour of the first.
+// Adding or removing a net only marks its own pins, and update() recalculates those alone.
+#ifndef NET_PINS
+#define NET_PINS 40
+#endif
+
+#ifndef NET_MAX
+#define NET_MAX 16
+#endif
+
+#ifndef NET_MAX_PINS
+#define NET_MAX_PINS 8 // Pins per net
+#endif
+
+#ifndef NET_COLORS
+#define NET_COLORS 8
+#endif
+
+#define NET_NO_COLOR 0xFF
+
+static_assert(NET_PINS < 256 && NET_MAX < NET_NO_COLOR, "Pins and nets are counted in uint8_t");
+
+struct Net {
+  uint8_t count; // 0 when the slot is free
+  uint8_t color;
+  uint8_t pins[NET_MAX_PINS];
+};
+
+struct NetTable {
+  Net nets[NET_MAX];
+  uint8_t pinNets[NET_PINS];        // Nets each pin is in
+  uint8_t pinColor[NET_PINS];       // What update() last worked out, NET_NO_COLOR for none
+  uint8_t changed[(NET_PINS + 7) / 8];
+
+  NetTable(){
+    clear();
+  }
+
+  void clear(){
+    memset(nets, 0, sizeof(nets));
+    memset(pinNets, 0, sizeof(pinNets));
+    memset(pinColor, NET_NO_COLOR, sizeof(pinColor));
+    memset(changed, 0, sizeof(changed));
+  }
+
+  bool full() const {
+    for (uint8_t i = 0; i < NET_MAX; i++){
+      if (nets[i].count == 0){
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Adds a net of count distinct pins in the first colour no other net has (the least used one
+  // when all are taken). Returns its colour, or NET_NO_COLOR when the table is full or a pin is bad.
+  uint8_t add(const uint8_t *pins, uint8_t count){
+    if (count == 0 || count > NET_MAX_PINS){
+      return NET_NO_COLOR;
+    }
+    for (uint8_t i = 0; i < count; i++){
+      if (pins[i] >= NET_PINS){
+        return NET_NO_COLOR;
+      }
+    }
+
+    uint8_t uses[NET_COLORS] = {0};
+    Net *slot = NULL;
+    for (uint8_t i = 0; i < NET_MAX; i++){
+      if (nets[i].count == 0){
+        slot = slot == NULL ? &nets[i] : slot;
+      }else{
+        uses[nets[i].color]++;
+      }
+    }
+    if (slot == NULL){
+      return NET_NO_COLOR;
+    }
+    uint8_t color = 0;
+    for (uint8_t c = 1; c < NET_COLORS; c++){
+      if (uses[c] < uses[color]){
+        color = c;
+      }
+    }
+
+    slot->count = count;
+    slot->color = color;
+    memcpy(slot->pins, pins, count);
+    for (uint8_t i = 0; i < count; i++){
+      pinNets[pins[i]]++;
+      mark(pins[i]);
+    }
+    return color;
+  }
+
+  // Removes the net with exactly these pins, in any order. False when there is none, and then
+  // nothing changes, so a pin another net still uses stays lit.
+  bool remove(const uint8_t *pins, uint8_t count){
+    for (uint8_t i = 0; i < NET_MAX; i++){
+      Net &net = nets[i];
+      if (net.count != count || !samePins(net, pins, count)){
+        continue;
+      }
+      for (uint8_t j = 0; j < count; j++){
+        pinNets[net.pins[j]]--;
+        mark(net.pins[j]);
+      }
+      net.count = 0;
+      return true;
+    }
+    return false;
+  }
+
+  // Recalculates the colour of every marked pin and calls show(pin, color) for each whose colour
+  // changed. Returns how many did.
+  template <class Show>
+  uint8_t update(Show show){
+    uint8_t shown = 0;
+    for (uint8_t pin = 0; pin < NET_PINS; pin++){
+      if (!(changed[pin / 8] & (1 << (pin % 8)))){
+        continue;
+      }
+      uint8_t color = colorOf(pin);
+      if (color != pinColor[pin]){
+        pinColor[pin] = color;
+        show(pin, color);
+        shown++;
+      }
+    }
+    memset(changed, 0, sizeof(changed));
+    return shown;
+  }
+
+private:
+  void mark(uint8_t pin){
+    changed[pin / 8] |= 1 << (pin % 8);
+  }
+
+  static bool samePins(const Net &net, const uint8_t *pins, uint8_t count){
+    for (uint8_t i = 0; i < count; i++){
+      if (memchr(net.pins, pins[i], net.count) == NULL){
+        return false;
+      }
+    }
+    return true;
+  }
+
+  uint8_t colorOf(uint8_t pin) const {
+    if (pinNets[pin] == 0){
+      return NET_NO_COLOR;
+    }
+    for (uint8_t i = 0; i < NET_MAX; i++){
+      if (nets[i].count != 0 && memchr(nets[i].pins, pin, nets[i].count) != NULL){
+        return nets[i].color;
+      }
+    }
+    return NET_NO_COLOR;
+  }
+};
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <stdint.h>
+
+// Binary serial commands, next to the text lines ("1000;y5;x10;true;MainBreadboard 15;MCUBreadboard 1").
+// A frame is
+//   SWITCH_FRAME_SYNC, count, count ops of 2 bytes, CRC-8 of count and the ops
+// and runs as one batch, answered by a single SWITCH_FRAME_ACK, or SWITCH_FRAME_NAK when the
+// CRC or an op is bad and nothing was run. The sync byte is not ASCII, so a frame is never
+// taken for a text line. Python13May/switch_frame.py builds the frames on the host.
+#define SWITCH_FRAME_SYNC 0xA5
+#define SWITCH_FRAME_ACK 0x06
+#define SWITCH_FRAME_NAK 0x15
+
+#ifndef SWITCH_FRAME_MAX_OPS
+#define SWITCH_FRAME_MAX_OPS 32
+#endif
+
+// Ops, the kind in the top 3 bits of the first byte:
+//   SWITCH_OP_SWITCH  kind << 5 | on << 4 | chip address    y << 4 | x
+//   SWITCH_OP_LED     kind << 5 | on << 4 | SWITCH_BOARD_*  LED index
+//   SWITCH_OP_CLEAR   kind << 5                            0
+#define SWITCH_OP_SWITCH 0
+#define SWITCH_OP_LED 1
+#define SWITCH_OP_CLEAR 2
+
+#define SWITCH_BOARD_MCU 0
+#define SWITCH_BOARD_MAIN 1
+
+inline uint8_t switchOpKind(const uint8_t *op){ return op[0] >> 5; }
+inline bool switchOpOn(const uint8_t *op){ return op[0] & 0x10; }
+inline uint8_t switchOpTarget(const uint8_t *op){ return op[0] & 0x0F; } // Chip address or board
+inline uint8_t switchOpX(const uint8_t *op){ return op[1] & 0x0F; }
+inline uint8_t switchOpY(const uint8_t *op){ return op[1] >> 4; }
+inline uint8_t switchOpIndex(const uint8_t *op){ return op[1]; }
+
+// CRC-8, polynomial 0x07, starting from 0
+inline uint8_t switchFrameCrc(uint8_t crc, uint8_t data){
+  crc ^= data;
+  for (uint8_t i = 0; i < 8; i++){
+    crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : crc << 1;
+  }
+  return crc;
+}
+
+struct SwitchFrame {
+  uint8_t count;
+  uint8_t ops[2 * SWITCH_FRAME_MAX_OPS + 1]; // The CRC follows the ops
+};
+
+// True when the CRC matches and every op is one of the kinds above with its fields in range.
+// LED indexes are left to the sketch, which knows the strip lengths.
+inline bool switchFrameValid(const SwitchFrame &frame){
+  if (frame.count == 0 || frame.count > SWITCH_FRAME_MAX_OPS){
+    return false;
+  }
+  uint8_t crc = switchFrameCrc(0, frame.count);
+  for (uint8_t i = 0; i < 2 * frame.count; i++){
+    crc = switchFrameCrc(crc, frame.ops[i]);
+  }
+  if (crc != frame.ops[2 * frame.count]){
+    return false;
+  }
+
+  for (uint8_t i = 0; i < frame.count; i++){
+    const uint8_t *op = frame.ops + 2 * i;
+    switch (switchOpKind(op)){
+      case SWITCH_OP_SWITCH:
+        if (switchOpY(op) > 7){
+          return false;
+        }
+        break;
+      case SWITCH_OP_LED:
+        if (switchOpTarget(op) > SWITCH_BOARD_MAIN){
+          return false;
+        }
+        break;
+      case SWITCH_OP_CLEAR:
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+#ifndef SWITCH_LINE_LENGTH
+#define SWITCH_LINE_LENGTH 64 // Longer text lines are dropped
+#endif
+
+// What SwitchParser::feed() completed
+#define SWITCH_PARSE_NONE 0
+#define SWITCH_PARSE_LINE 1  // line holds a text command, without its newline
+#define SWITCH_PARSE_FRAME 2 // frame holds a frame, still to be checked with switchFrameValid
+#define SWITCH_PARSE_BAD 3   // A frame with a count out of range, dropped with the bytes after it
+
+// Splits the incoming bytes into text lines and binary frames one byte at a time, so a command
+// can run as soon as its last byte is in. The line and the frame live in fixed buffers. The rest
+// of a frame with a bad count is discarded up to the next SYNC or newline, never read as text.
+struct SwitchParser {
+  enum State : uint8_t { IDLE, LINE, SKIP_LINE, COUNT, OPS, SKIP_FRAME };
+
+  State state = IDLE;
+  uint8_t length = 0;
+  char line[SWITCH_LINE_LENGTH + 1];
+  SwitchFrame frame;
+
+  uint8_t feed(uint8_t c){
+    switch (state){
+      case IDLE:
+        if (c == SWITCH_FRAME_SYNC){
+          state = COUNT;
+          return SWITCH_PARSE_NONE;
+        }
+        if (c == '\n' || c == '\r'){
+          return SWITCH_PARSE_NONE; // Empty lines and the second half of CRLF
+        }
+        length = 0;
+        state = LINE;
+        // fall through
+      case LINE:
+        if (c == '\n' || c == '\r'){
+          line[length] = '\0';
+          state = IDLE;
+          return SWITCH_PARSE_LINE;
+        }
+        if (length == SWITCH_LINE_LENGTH){
+          state = SKIP_LINE;
+          return SWITCH_PARSE_NONE;
+        }
+        line[length++] = c;
+        return SWITCH_PARSE_NONE;
+      case SKIP_LINE:
+        if (c == '\n' || c == '\r'){
+          state = IDLE;
+        }
+        return SWITCH_PARSE_NONE;
+      case COUNT:
+        if (c == 0 || c > SWITCH_FRAME_MAX_OPS){
+          state = SKIP_FRAME;
+          return SWITCH_PARSE_BAD;
+        }
+        frame.count = c;
+        length = 0;
+        state = OPS;
+        return SWITCH_PARSE_NONE;
+      case OPS:
+        frame.ops[length++] = c;
+        if (length == 2 * frame.count + 1){
+          state = IDLE;
+          return SWITCH_PARSE_FRAME;
+        }
+        return SWITCH_PARSE_NONE;
+      case SKIP_FRAME:
+        if (c == SWITCH_FRAME_SYNC){
+          state = COUNT;
+        }else if (c == '\n'){
+          state = IDLE;
+        }
+        return SWITCH_PARSE_NONE;
+    }
+    return SWITCH_PARSE_NONE;
+  }
+
+  // True inside a command
+  bool busy() const { return state != IDLE; }
+
+  // Ends a command the host stopped sending: a text line runs as far as it got, like
+  // Serial.readStringUntil did, and a cut off frame is dropped.
+  uint8_t timeout(){
+    State was = state;
+    state = IDLE;
+    if (was == LINE){
+      line[length] = '\0';
+      return SWITCH_PARSE_LINE;
+    }
+    return was == COUNT || was == OPS ? SWITCH_PARSE_BAD : SWITCH_PARSE_NONE;
+  }
+};
@@ -1,5 +1,9 @@
 #include "Arduino.h"
 #include <FastLED.h>
+#define CH446Q_MUX_ADDRESSES {0b1000, 0b1001} // MUX1, MUX2
+#define CH446Q_STATS // "Stats" prints the switch timing
+#include <CH446Q.h>
+#include "SwitchFrame.h"
 
 #define NUM_COLORS 8
 CRGB colors[NUM_COLORS] = {
@@ -22,284 +26,395 @@ CRGB colors[NUM_COLORS] = {
 CRGB leds_1[NUM_LEDS_1];
 CRGB leds_2[NUM_LEDS_2];
 
+// Net table pins are the MCU breadboard LEDs, then the main breadboard ones
+#define NET_PINS (NUM_LEDS_1 + NUM_LEDS_2)
+#define NET_COLORS NUM_COLORS
+#include "NetTable.h"
+
+NetTable nets;
+
+// The link starts at SERIAL_BAUD after every reset, "Baud <rate>" tries a faster one and keeps it
+// once "Ping" arrives at the new rate within BAUD_TRIAL_MS. "Ping" is answered with
+// "Credits <n>": the host keeps at most n bytes of unacknowledged frames on the way, so they
+// always fit in the receive buffer.
+#define SERIAL_BAUD 9600
+#define SERIAL_MAX_BAUD 2000000
+#define BAUD_TRIAL_MS 500
+
+#ifdef SERIAL_RX_BUFFER_SIZE
+#define SERIAL_CREDITS (SERIAL_RX_BUFFER_SIZE - 1) // The core's ring buffer keeps one slot free
+#else
+#define SERIAL_CREDITS 63
+#endif
+
+unsigned long serialBaud = SERIAL_BAUD;
+unsigned long trialBaud = 0; // Rate on trial, 0 when none
+unsigned long trialMillis = 0;
+
+// FastLED.show() keeps interrupts off for about 30 us per LED, long enough to lose serial bytes,
+// so commands only mark the LEDs dirty. loop() shows them at most every LED_FRAME_MS, once the
+// link has been quiet for LED_QUIET_MS, and frame replies are held back until then. The host keeps
+// at most HELD_REPLIES frames unanswered, so once they are all in it sends nothing new until the
+// LEDs have been shown.
+#define LED_FRAME_MS 20
+#define LED_QUIET_MS 2
+#define HELD_REPLIES 16
+
+bool ledsDirty = false;
+unsigned long lastShowMillis = 0;
+uint8_t heldReplies[HELD_REPLIES];
+uint8_t heldReplyCount = 0;
+
+// For "Stats". The bytes the host sent since its last "Ping" minus serialBytes are the ones lost.
+uint32_t ledShows = 0;
+uint32_t ledShowMicros = 0;
+uint32_t ledMaxMicros = 0;
+uint32_t serialBytes = 0;
+uint32_t badFrames = 0;
+
 void(* resetFunc) (void) = 0;
 
-#define STB (1 << PORTB3)
-#define STB_DDR (1 << DDB3)
+// Queues a switch of the chip the serial protocol names, "1000"/"1001" or "MUX1"/"MUX2".
+// The switches go out in one batch once no more commands are waiting, see loop().
+int setCommandConnection(const char *chip, uint8_t AX, uint8_t AY, bool mode){
+  int8_t addr = ch446qDecodeChip(chip);
+  if (addr < 0){
+    return -1;
+  }
 
-#define DAT (1 << PORTB4)
-#define DAT_DDR (1 << DDB4)
+  return ch446qQueue(addr, AX, AY, mode);
+}
 
-#define AY0 (1 << PORTB0) 
-#define AY1 (1 << PORTB1)
-#define AY2 (1 << PORTB2)
+void setup(){
 
-#define AY0_DDR (1 << DDB0)
-#define AY1_DDR (1 << DDB1)
-#define AY2_DDR (1 << DDB2)
+    Serial.begin(SERIAL_BAUD);
 
-#define AX0 (1 << PORTC0) //A0
-#define AX1 (1 << PORTC1) //A1
-#define AX2 (1 << PORTC2) //A2
-#define AX3 (1 << PORTC3) //A3
+    ch446qInit();
 
-#define AX0_DDR (1 << DDC0) //A0
-#define AX1_DDR (1 << DDC1) //A1
-#define AX2_DDR (1 << DDC2) //A2
-#define AX3_DDR (1 << DDC3) //A3
+    FastLED.addLeds<WS2812, LED_PIN_1, GRB>(leds_1, NUM_LEDS_1);
+    FastLED.addLeds<WS2812, LED_PIN_2, GRB>(leds_2, NUM_LEDS_2);
 
-#define AX_PORT PORTC
-#define AY_PORT PORTB
-#define CONTROL_PORT PORTB
+#ifndef CH446Q_RST
+    // Without RST the switches may still be closed from before an MCU reset
+    ch446qClearChip(0b1000);
+    ch446qClearChip(0b1001);
+#endif
 
-#define AX_PORT_DDR DDRC
-#define AY_PORT_DDR DDRB 
-#define CONTROL_PORT_DDR DDRB
+    for (int i = 0; i < NUM_LEDS_1; i++) {
+        leds_1[i] = CRGB(0, 0, 0);;
+    }
 
-#define ADDR0 (1 << PORTD4)
-#define ADDR1 (1 << PORTD5)
-#define ADDR2 (1 << PORTD6)
-#define ADDR3 (1 << PORTD7)
+    for (int i = 0; i < NUM_LEDS_2; i++) {
+        leds_2[i] = CRGB(0, 0, 0);;
+    }
 
-#define ADDR0_DDR (1 << DDD4)
-#define ADDR1_DDR (1 << DDD5)
-#define ADDR2_DDR (1 << DDD6)
-#define ADDR3_DDR (1 << DDD7)
+    FastLED.show();
 
-#define ADDR_PORT PORTD
-#define ADDR_PORT_DDR DDRD
+    Serial.println("Ready");
+}
 
-#define MAX_ADDRESS 15 // change later
-#define MAX_AX 15 // 2^n -1
-#define MAX_AY 7
+void clearAll(){
+  ch446qClear(); // Only the switches that are closed
+  nets.clear();
 
-int setConnection(int addr, uint8_t AX, uint8_t AY, bool mode){
-  uint8_t actuallAddr;
-  if (addr == 1000){
-    actuallAddr = 0b1000;
-    // Serial.println("I have just set addr to 0b1000");
-  }else if (addr == 1001){
-    actuallAddr = 0b1001;
-    // Serial.println("I have just set addr to 0b1001");
+  for (int i = 0; i < NUM_LEDS_1; i++) {
+    leds_1[i] = CRGB(0, 0, 0);;
   }
 
-  if (actuallAddr > MAX_ADDRESS || AX > MAX_AX || AY > MAX_AY){
-    return -1;
+  for (int i = 0; i < NUM_LEDS_2; i++) {
+    leds_2[i] = CRGB(0, 0, 0);;
   }
+}
 
-  // AX = uint8_t(AX);
-  // AY = uint8_t(AY);
-
-
-  ADDR_PORT = (ADDR_PORT & 0x0F) | (actuallAddr << 4); /// pazq starta stojnost na 4-te bita koito ne iskam da pipam i zadavam nova stojnost na 4 bita, kojto promenqm
+void showLeds(){
+  uint32_t start = micros();
+  FastLED.show();
+  // Can come out one timer 0 overflow (1024 us) short on AVR, its interrupt is held off too
+  uint32_t elapsed = micros() - start;
 
-  AX_PORT = (AX_PORT & 0xF0) | AX;
+  ledShows++;
+  ledShowMicros += elapsed;
+  if (elapsed > ledMaxMicros){
+    ledMaxMicros = elapsed;
+  }
+  ledsDirty = false;
+  lastShowMillis = millis();
 
-  AY_PORT = (AY_PORT & 0xF8) | AY; 
+  Serial.write(heldReplies, heldReplyCount);
+  heldReplyCount = 0;
+}
 
-  if (mode){
-    CONTROL_PORT |= DAT;
+// Sends the ACK or NAK of a frame, or holds it back while the LEDs wait to be shown
+void reply(uint8_t r){
+  if (r == SWITCH_FRAME_NAK){
+    badFrames++;
+  }
+  if (ledsDirty && heldReplyCount == HELD_REPLIES){
+    showLeds();
+  }
+  if (ledsDirty){
+    heldReplies[heldReplyCount++] = r;
   }else{
-    CONTROL_PORT &= ~DAT;
+    Serial.write(r);
   }
+}
 
-  CONTROL_PORT |= STB;
+void printSketchStats(){
+  Serial.print("ledShows "); Serial.println(ledShows);
+  Serial.print("ledShowMicros "); Serial.println(ledShowMicros);
+  Serial.print("ledMaxMicros "); Serial.println(ledMaxMicros);
+  Serial.print("serialBytes "); Serial.println(serialBytes);
+  Serial.print("badFrames "); Serial.println(badFrames);
+}
 
-  delayMicroseconds(2);
+// Net table pin of the LED a text command names, "MainBreadboard 15" or "MCUBreadboard 1", or -1
+int commandLedPin(char *led){
+  char *space = strchr(led, ' ');
+  if (space == NULL){
+    return -1;
+  }
+  *space = '\0';
+  int idx = atoi(space + 1);
 
-  CONTROL_PORT &= ~STB;
+  if (strcmp(led, "MCUBreadboard") == 0 && idx >= 0 && idx < NUM_LEDS_1) {
+    return idx;
+  }
+  else if (strcmp(led, "MainBreadboard") == 0 && idx >= 0 && idx < NUM_LEDS_2) {
+    return NUM_LEDS_1 + idx;
+  }
+  return -1;
+}
 
-  return 1;
-} 
+// Adds pin to the pins of a net unless it is there already. False when the net is full.
+bool addNetPin(uint8_t *pins, uint8_t &count, uint8_t pin){
+  if (memchr(pins, pin, count) != NULL){
+    return true;
+  }
+  if (count == NET_MAX_PINS){
+    return false;
+  }
+  pins[count++] = pin;
+  return true;
+}
 
+// Writes the LEDs of the pins whose net colour changed
+void updateLeds(){
+  uint8_t shown = nets.update([](uint8_t pin, uint8_t color){
+    CRGB c = color == NET_NO_COLOR ? CRGB(0, 0, 0) : colors[color];
+    if (pin < NUM_LEDS_1){
+      leds_1[pin] = c;
+    }else{
+      leds_2[pin - NUM_LEDS_1] = c;
+    }
+  });
+  if (shown > 0){
+    ledsDirty = true;
+  }
+}
 
-void setup(){
+// Answers "Baud <rate>" at the current rate, then listens at the new one. An unsupported rate
+// is answered with the current one.
+void startBaudTrial(unsigned long baud){
+  if (baud < SERIAL_BAUD || baud > SERIAL_MAX_BAUD) {
+    baud = serialBaud;
+  }
+  if (ledsDirty) {
+    showLeds(); // Held replies go first
+  }
+  Serial.print("Baud ");
+  Serial.println(baud);
+  if (baud == serialBaud) {
+    return;
+  }
 
-    Serial.begin(9600);
+  ch446qFlush();
+  Serial.flush(); // The answer goes out at the old rate
+  Serial.end();
+  Serial.begin(baud);
+  trialBaud = baud;
+  trialMillis = millis();
+}
 
-    ADDR_PORT_DDR |= ADDR0_DDR | ADDR1_DDR | ADDR2_DDR | ADDR3_DDR; // Init D Port Arduino
+// Runs a text command, "1000;y5;x10;true;MainBreadboard 15;MCUBreadboard 1" (x and y either
+// way round, the LEDs optional), "Clear" or "Stats". The line is split in place.
+void runLine(char *input){
+  if (strcmp(input, "Ping") == 0) {
+    if (trialBaud != 0) {
+      serialBaud = trialBaud;
+      trialBaud = 0;
+    }
+    if (ledsDirty) {
+      showLeds(); // Held replies go first
+    }
+    serialBytes = 0;
+    Serial.print("Credits ");
+    Serial.println(SERIAL_CREDITS);
+    return;
+  }
 
-    ADDR_PORT &= ~(ADDR0 | ADDR1 | ADDR2 | ADDR3);
+  if (strncmp(input, "Baud ", 5) == 0) {
+    startBaudTrial(strtoul(input + 5, NULL, 10));
+    return;
+  }
 
+  if (strcmp(input, "Stats") == 0) {
+    ch446qFlush(); // Count what is still queued
+    if (ledsDirty) {
+      showLeds();
+    }
+    ch446qPrintStats(Serial);
+    printSketchStats();
+    return;
+  }
 
-    AY_PORT_DDR |= AY0_DDR | AY1_DDR | AY2_DDR;// Init B Port Arduino
+  if (strcmp(input, "Clear") == 0) {
+    clearAll();
+    ledsDirty = true;
+    return;
+  }
 
-    AY_PORT &= ~(AY0 | AY1 | AY2);
+  char* chip = strtok(input, ";");
 
+  // get x
+  char* xStr = strtok(NULL, ";");
 
-    AX_PORT_DDR |= AX0_DDR | AX1_DDR | AX2_DDR | AX3_DDR;// Init C Port Arduino
+  // get y
+  char* yStr = strtok(NULL, ";");
 
-    AX_PORT &= ~(AX0 | AX1 | AX2 | AX3);
+  // get MODE
+  char* modeStr = strtok(NULL, ";");
 
+  if (modeStr == NULL) {
+    return;
+  }
 
-    CONTROL_PORT_DDR |= STB_DDR | DAT_DDR;
+  if (xStr[0] == 'y') {
+    char* temp = yStr;
+    yStr = xStr;
+    xStr = temp;
+  }
 
-    CONTROL_PORT |= DAT;
-    CONTROL_PORT &= ~STB;
+  int x = atoi(xStr + 1);
+  int y = atoi(yStr + 1);
+  bool mode = (strcmp(modeStr, "true") == 0);
 
-    FastLED.addLeds<WS2812, LED_PIN_1, GRB>(leds_1, NUM_LEDS_1);
-    FastLED.addLeds<WS2812, LED_PIN_2, GRB>(leds_2, NUM_LEDS_2);
+  if (setCommandConnection(chip, x, y, mode) < 0) {
+    return; // Unknown chip or switch, the LEDs stay as they are
+  }
 
-    for (int x = 0; x < 16; x++) {
-        for (int y = 0; y < 8; y++) {
-            setConnection(0b1000, x, y, false);
-            setConnection(0b1001, x, y, false);
-        }
-    }
-    
-    for (int i = 0; i < NUM_LEDS_1; i++) {
-        leds_1[i] = CRGB(0, 0, 0);;
+  // get LED 1 and LED 2, the pins of the net this connection makes or breaks
+  uint8_t pins[NET_MAX_PINS];
+  uint8_t pinCount = 0;
+  for (char* led = strtok(NULL, ";"); led != NULL; led = strtok(NULL, ";")) {
+    int pin = commandLedPin(led);
+    if (pin >= 0) {
+      addNetPin(pins, pinCount, pin);
     }
+  }
 
-    for (int i = 0; i < NUM_LEDS_2; i++) {
-        leds_2[i] = CRGB(0, 0, 0);;
+  if (pinCount > 0) {
+    if (mode) {
+      nets.add(pins, pinCount);
     }
-
-    FastLED.show();
-
-    Serial.println("Ready");
+    else {
+      nets.remove(pins, pinCount);
+    }
+    updateLeds();
+  }
 }
 
-int currentColorIndex = 0;
-
-void loop(){
-  if(Serial.available() > 0){
-    // String input = "1000;x15;y7;false;MCUBreadboard 15;MainBreadboard 1";
-    String input = Serial.readStringUntil('\n');
-
-    if(input.equals("Clear")) {
-      for (int x = 0; x < 16; x++) {
-        for (int y = 0; y < 8; y++) {
-            setConnection(0b1000, x, y, false);
-            setConnection(0b1001, x, y, false);
-        }
-      }
-
-      for (int i = 0; i < NUM_LEDS_1; i++) {
-        leds_1[i] = CRGB(0, 0, 0);;
-      }
-
-      for (int i = 0; i < NUM_LEDS_2; i++) {
-        leds_2[i] = CRGB(0, 0, 0);;
-      }
+// Runs a binary frame as one batch: the switches are strobed together, then one ACK goes back.
+// The LEDs it turns on are the pins of one new net, the ones it turns off those of a net to
+// remove, as the host sends one connection per frame. A bad frame is answered with NAK and
+// changes nothing. The ACK may wait for the next LED refresh, see showLeds().
+void runFrame(const SwitchFrame &frame){
+  uint8_t onPins[NET_MAX_PINS], offPins[NET_MAX_PINS];
+  uint8_t onCount = 0, offCount = 0;
+
+  bool valid = switchFrameValid(frame);
+  for (uint8_t i = 0; valid && i < frame.count; i++){
+    const uint8_t *op = frame.ops + 2 * i;
+    if (switchOpKind(op) == SWITCH_OP_LED){
+      bool mcu = switchOpTarget(op) == SWITCH_BOARD_MCU;
+      uint8_t pin = mcu ? switchOpIndex(op) : NUM_LEDS_1 + switchOpIndex(op);
+      valid = switchOpIndex(op) < (mcu ? NUM_LEDS_1 : NUM_LEDS_2)
+          && (switchOpOn(op) ? addNetPin(onPins, onCount, pin) : addNetPin(offPins, offCount, pin));
+    }else if (switchOpKind(op) == SWITCH_OP_CLEAR){
+      onCount = 0; // The clear drops the nets before it
+      offCount = 0;
     }
+  }
+  if (!valid){
+    reply(SWITCH_FRAME_NAK);
+    return;
+  }
 
-//    Serial.println(input);
-
-
-    char* token;
-    token = strtok((char*)input.c_str(), ";"); 
-    int instruction = atoi(token);
+  for (uint8_t i = 0; i < frame.count; i++){
+    const uint8_t *op = frame.ops + 2 * i;
+    if (switchOpKind(op) == SWITCH_OP_SWITCH){
+      ch446qQueue(switchOpTarget(op), switchOpX(op), switchOpY(op), switchOpOn(op));
+    }else if (switchOpKind(op) == SWITCH_OP_CLEAR){
+      clearAll(); // Also drops the switches queued before it
+      ledsDirty = true;
+    }
+  }
+  ch446qFlush();
 
-    // get x
-    token = strtok(NULL, ";");
-    char* xStr = token;
+  if (offCount > 0){
+    nets.remove(offPins, offCount);
+  }
+  if (onCount > 0){
+    nets.add(onPins, onCount);
+  }
+  updateLeds();
+  reply(SWITCH_FRAME_ACK);
+}
 
-    // get y
-    token = strtok(NULL, ";"); 
-    char* yStr = token;
+// Longest pause inside one command, as Serial.readStringUntil used to wait
+#define COMMAND_TIMEOUT_MS 1000
 
-    if (xStr[0] == 'y') {
-      char* temp = yStr;
-      yStr = xStr;
-      xStr = temp;
-    }
+SwitchParser parser;
+unsigned long lastByteMillis = 0;
 
-    xStr[0] = '0';
-    yStr[0] = '0';
-
-    int x = atoi(xStr);
-    int y = atoi(yStr);
-
-    // get MODE
-    token = strtok(NULL, ";"); 
-    bool mode = (strcmp(token, "true") == 0);
-    
-    /// NOT ALWAYS vvv
-
-    // int red = random(5, 26);
-    // int green = random(5, 26);
-    // int blue = random(5, 26);
-
-    CRGB selectedColor = colors[currentColorIndex];
-
-    // Increment the color index, reset if it exceeds the array
-    currentColorIndex = (currentColorIndex + 1) % NUM_COLORS;
-
-    // get LED 1
-    token = strtok(NULL, ";"); 
-    String led1Instruction = token;
-    int spaceIndex = led1Instruction.indexOf(' ');
-    String boardName = led1Instruction.substring(0, spaceIndex);
-
-    // Serial.println(mode);
-
-    if (mode){
-      if (boardName.equals("MCUBreadboard")) {
-        int led1Idx = atoi(led1Instruction.substring(spaceIndex + 1).c_str());
-        // Serial.println(led1Idx);
-        leds_1[led1Idx] = selectedColor;
-      }
-      else  if (boardName.equals("MainBreadboard")) {
-        int led2Idx = atoi(led1Instruction.substring(spaceIndex + 1).c_str());
-        // Serial.println(led1Idx);
-        leds_2[led2Idx] = selectedColor;
-      }
-      
-      // get LED 2
-      token = strtok(NULL, ";"); 
-      String led2Instruction = token;
-      spaceIndex = led2Instruction.indexOf(' ');
-      boardName = led2Instruction.substring(0, spaceIndex);
-
-      if (boardName.equals("MCUBreadboard")) {
-        int led2Idx = atoi(led2Instruction.substring(spaceIndex + 1).c_str());
-        // Serial.println(led2Idx);
-        leds_1[led2Idx] = selectedColor;
-      }
-      else  if (boardName.equals("MainBreadboard")) {
-        int led2Idx = atoi(led2Instruction.substring(spaceIndex + 1).c_str());
-        // Serial.println(led2Idx);
-        leds_2[led2Idx] = selectedColor;
-      }
-    }else{
-      if (boardName.equals("MCUBreadboard")) {
-        int led1Idx = atoi(led1Instruction.substring(spaceIndex + 1).c_str());
-        // Serial.println(led1Idx);
-        leds_1[led1Idx] = CRGB(0, 0, 0);
-      }
-      else  if (boardName.equals("MainBreadboard")) {
-        int led2Idx = atoi(led1Instruction.substring(spaceIndex + 1).c_str());
-        // Serial.println(led1Idx);
-        leds_2[led2Idx] = CRGB(0, 0, 0);
-      }
-      
-      // get LED 2
-      token = strtok(NULL, ";"); 
-      String led2Instruction = token;
-      spaceIndex = led2Instruction.indexOf(' ');
-      boardName = led2Instruction.substring(0, spaceIndex);
-
-      if (boardName.equals("MCUBreadboard")) {
-        int led2Idx = atoi(led2Instruction.substring(spaceIndex + 1).c_str());
-        // Serial.println(led2Idx);
-        leds_1[led2Idx] = CRGB(0, 0, 0);
-      }
-      else  if (boardName.equals("MainBreadboard")) {
-        int led2Idx = atoi(led2Instruction.substring(spaceIndex + 1).c_str());
-        // Serial.println(led2Idx);
-        leds_2[led2Idx] = CRGB(0, 0, 0);
-      }
-    }
-
-    // Serial.println("Im on 295 line");
+void runParsed(uint8_t event){
+  if (event == SWITCH_PARSE_LINE){
+    runLine(parser.line);
+  }else if (event == SWITCH_PARSE_FRAME){
+    runFrame(parser.frame);
+  }else if (event == SWITCH_PARSE_BAD){
+    reply(SWITCH_FRAME_NAK);
+  }
+}
 
-    FastLED.show();
+void loop(){
+  // The core's USART interrupt keeps filling its receive ring buffer while a command runs,
+  // each byte is taken from there as it comes and a command runs once its last byte is in
+  while (Serial.available() > 0){
+    lastByteMillis = millis();
+    serialBytes++;
+    runParsed(parser.feed(Serial.read()));
+  }
 
-    setConnection(instruction, x, y, mode);
+  if (parser.busy() && millis() - lastByteMillis > COMMAND_TIMEOUT_MS){
+    runParsed(parser.timeout());
+  }
 
-    // Serial.println("Im on 302 line");
+  // No "Ping" got through at the rate on trial, back to the last one that worked
+  if (trialBaud != 0 && millis() - trialMillis > BAUD_TRIAL_MS){
+    trialBaud = 0;
+    Serial.end();
+    Serial.begin(serialBaud);
+    parser = SwitchParser();
+  }
 
+  // The host sends the commands of one connection back to back, strobe them together
+  if (ch446qQueuedCount > 0 && Serial.available() == 0){
+    ch446qFlush();
+  }
 
+  // One refresh for everything the batch changed
+  if (ledsDirty && !parser.busy() && Serial.available() == 0 && millis() - lastByteMillis >= LED_QUIET_MS
+      && millis() - lastShowMillis >= LED_FRAME_MS){
+    showLeds();
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+// The sketches use the driver as a library: set the Arduino sketchbook location to the root of
+// this repository and it finds this folder. The driver itself is CH446Q/Arduino/CH446Q.h.
+#include "../../CH446Q/Arduino/CH446Q.h"